@@ -0,0 +1,98 @@
+/*
+    * BarGraph.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the drawing of the FFT bar graph as a function
+    *  template over the display. The sketch draws on the TFT_eSPI (or a
+    *  sprite of it) through PlotFFTBarGraph(), the host build of the pipeline
+    *  benchmark draws the same calls into a framebuffer in RAM. The display
+    *  needs fillRect(), fillTriangle(), drawRect(), setCursor(), print() and printf().
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _BARGRAPH_H
+#define _BARGRAPH_H
+
+#include <stdint.h>
+#include "PlotScale.h"
+
+//Defines
+#define BAR_GRAPH_INK 0x0000                            //TFT_BLACK, the box and the markers
+
+/*
+*   Function to draw the bars of the FFT plot and its text.
+*   Only the part of the box the last bars reached is cleared, MaxBarHeight keeps it from frame to frame.
+*   Input: Display &tft - The display.
+*   Input: const uint32_t *DisplayData - The bars.
+*   Input: int Channel - Number of bars.
+*   Input: float FPeak - The frequency printed, the dominant one.
+*   Input: double fps - The frame rate printed.
+*   Input: uint16_t PlotColor - The color of the bars.
+*   Input: uint16_t Background - The color of the screen.
+*   Input: bool DrawText - False skips the text.
+*   Input: const uint8_t *Markers - Bars to mark with a triangle, MarkerCount of them.
+*   Input: int &MaxBarHeight - Highest bar or marker of the last frame, set to the one of this frame.
+*   Output: None.
+*/
+template <class Display>
+void DrawBarGraph(Display &tft, const uint32_t *DisplayData, int Channel, float FPeak, double fps, uint16_t PlotColor, uint16_t Background,
+                  bool DrawText, const uint8_t *Markers, int MarkerCount, int &MaxBarHeight){
+  //Clear Screen
+  uint16_t SCRCLR = Background;
+  //tft.fillScreen(SCRCLR);
+  //tft.fillRect(startX+1, startY+1, BoxW-2, BoxH-2, SCRCLR);                                     //This is to clear the previous plot
+  tft.fillRect(startX+1, startY + BoxH - MaxBarHeight, BoxW-2, MaxBarHeight, SCRCLR);             //Plot based clear screen, potentially faster.
+  tft.fillRect(TEXT_startX, TEXT_startY, TEXT_WIDTH, TEXT_HEIGHT, SCRCLR);                        //This is to clear the text that prints the average value 
+  //Clear the rest two texts as well.
+  tft.fillRect(TEXT2_startX, TEXT2_startY, TEXT2_WIDTH, TEXT2_HEIGHT, SCRCLR);
+  //tft.fillRect(TEXT3_startX, TEXT3_startY, TEXT3_WIDTH, TEXT3_HEIGHT, SCRCLR);
+
+  MaxBarHeight = 0;
+  
+  //Now plot the bar graph  200000
+  uint16_t BarWidth = BoxW / Channel;
+  uint16_t BarHeight = 0;
+  uint16_t Xpos = startX;
+  uint16_t Ypos = startY + BoxH;
+  for(int i = 0; i < Channel; i++){
+    BarHeight = BarHeightOf(DisplayData[i]);
+    Ypos = Ypos - BarHeight;
+
+    if(BarHeight > MaxBarHeight){
+      MaxBarHeight = BarHeight;
+    }
+    //Now we have the rectangle's starting X and Y, and width and height. draw it.
+    tft.fillRect(Xpos, Ypos, BarWidth, BarHeight, PlotColor);
+
+    //Now increment the Xposition for the next bar.
+    Xpos += BarWidth;
+    Ypos = startY + BoxH;
+  }
+  //A small triangle pointing down at the top of every marked bar, inside the box.
+  //The area cleared next frame is grown to take the markers as well.
+  for(int i = 0; i < MarkerCount; i++){
+    if(Markers[i] >= Channel){
+      continue;
+    }
+    BarHeight = BarHeightOf(DisplayData[Markers[i]]);
+    uint16_t Top = (BarHeight + PEAK_MARKER_SIZE + 1 < BoxH)? BarHeight + PEAK_MARKER_SIZE + 1 : BoxH - 1;
+    int Tip = startY + BoxH - (Top - PEAK_MARKER_SIZE);
+    int Centre = startX + Markers[i] * BarWidth + BarWidth / 2;
+    tft.fillTriangle(Centre - PEAK_MARKER_SIZE/2, Tip - PEAK_MARKER_SIZE, Centre + PEAK_MARKER_SIZE/2, Tip - PEAK_MARKER_SIZE, Centre, Tip - 1, BAR_GRAPH_INK);
+    if(Top > MaxBarHeight){
+      MaxBarHeight = Top;
+    }
+  }
+    //Draw Box
+  tft.drawRect(startX, startY, BoxW, BoxH, BAR_GRAPH_INK);
+    //Now print the text.
+  if(DrawText){
+    tft.setCursor(TEXT_startX, TEXT_startY);
+    tft.print((int)fps);                        //Print the Framerate if required.
+    tft.setCursor(TEXT2_startX, TEXT2_startY);
+    tft.printf("%.1f", FPeak);                  //Print the dominant frequency, the partial tracker resolves it to a fraction of a Hz
+    tft.setCursor(TEXT3_startX, TEXT3_startY);
+    tft.print("FREQUENCY PLOT");
+  }
+}
+#endif //_BARGRAPH_H
@@ -0,0 +1,134 @@
+/*
+*   BeatDetector.cpp
+*   Created on: Oct 19, 2026
+*   Spectral flux onset detection with an adaptive threshold, and the tempo of the onsets.
+*/
+#include "BeatDetector.h"
+#include <math.h>
+
+//Functions
+
+/*
+*   Function to set up the beat detector.
+*   Input: BeatDetector *B - The detector.
+*   Input: float *Previous - Memory for the magnitudes of the last frame, BinEnd + 1 floats.
+*   Input: int BinStart, BinEnd - Range of bins to look at, usually the bins on the FFT plot.
+*   Output: None.
+*/
+void InitializeBeatDetector(BeatDetector *B, float *Previous, int BinStart, int BinEnd){
+  B->Previous = Previous;
+  B->BinStart = BinStart;
+  B->BinEnd = BinEnd;
+  B->HasPrevious = false;
+  B->FluxIndex = 0;
+  B->FluxCount = 0;
+  B->LastFlux = 0;
+  B->LastBeat = 0;
+  B->IntervalIndex = 0;
+  B->IntervalCount = 0;
+  B->Beats = 0;
+  B->Bpm = 0;
+  B->Strength = 0;
+}
+
+/*
+*   Function to get the typical time between beats.
+*   Beats are only seen at frame times, so the intervals come in steps of a frame. The median throws
+*   out missed and extra beats, the mean of the intervals close to it evens out the steps.
+*   Input: const BeatDetector *B - The detector.
+*   Output: float - The beat interval(us).
+*/
+static float BeatInterval(const BeatDetector *B){
+  unsigned long Sorted[BEAT_INTERVALS];
+  int Count = B->IntervalCount;
+  for(int i = 0; i < Count; i++){
+    //Insertion sort, there are only a few of them.
+    unsigned long v = B->Intervals[i];
+    int j = i;
+    for(; j > 0 && Sorted[j - 1] > v; j--){
+      Sorted[j] = Sorted[j - 1];
+    }
+    Sorted[j] = v;
+  }
+  float Median = Sorted[Count / 2];
+  float Sum = 0;
+  int Used = 0;
+  for(int i = 0; i < Count; i++){
+    if(fabs(Sorted[i] - Median) <= 0.25 * Median){
+      Sum += Sorted[i];
+      Used++;
+    }
+  }
+  return Sum / Used;
+}
+
+/*
+*   Function to feed a new frame of magnitudes to the beat detector.
+*   The flux is the rise in magnitude from the last frame, summed over the bins and divided by
+*   the total magnitude, so it does not depend on the volume. A frame is an onset when its flux
+*   is a peak and stands BEAT_SENSITIVITY standard deviations above the recent flux.
+*   Costs a few operations per bin, far less than the FFT.
+*   Input: BeatDetector *B - The detector.
+*   Input: const float *Magnitude - Magnitude of every bin, indexed by bin (Spectrum after SpectrumPipeline::Magnitudes()).
+*   Input: unsigned long Now - Capture time of the frame(us).
+*   Output: bool - True if the frame is a beat.
+*/
+bool DetectBeat(BeatDetector *B, const float *Magnitude, unsigned long Now){
+  float Rise = 0;
+  float Total = 1e-6;
+  for(int i = B->BinStart; i <= B->BinEnd; i++){
+    float m = Magnitude[i];
+    float d = m - B->Previous[i];
+    Rise += (d > 0)? d : 0;
+    Total += m;
+    B->Previous[i] = m;
+  }
+  if(!B->HasPrevious){
+    B->HasPrevious = true;
+    return false;
+  }
+  float Flux = Rise / Total;
+
+  //Threshold from the flux of the frames before this one
+  float Mean = 0, Var = 0;
+  for(int i = 0; i < B->FluxCount; i++){
+    Mean += B->Flux[i];
+  }
+  Mean = (B->FluxCount > 0)? Mean / B->FluxCount : 0;
+  for(int i = 0; i < B->FluxCount; i++){
+    Var += (B->Flux[i] - Mean) * (B->Flux[i] - Mean);
+  }
+  float Threshold = Mean + BEAT_SENSITIVITY * ((B->FluxCount > 0)? sqrt(Var / B->FluxCount) : 0);
+  if(Threshold < BEAT_MIN_FLUX){
+    Threshold = BEAT_MIN_FLUX;
+  }
+
+  B->Flux[B->FluxIndex] = Flux;
+  B->FluxIndex = (B->FluxIndex + 1) % BEAT_HISTORY;
+  if(B->FluxCount < BEAT_HISTORY){
+    B->FluxCount++;
+  }
+
+  bool Onset = (Flux > Threshold) && (Flux > B->LastFlux) && (B->FluxCount >= BEAT_HISTORY / 2);
+  B->LastFlux = Flux;
+  if(!Onset || ((B->Beats > 0) && (Now - B->LastBeat < BEAT_MIN_INTERVAL_US))){
+    return false;
+  }
+
+  //A beat, work out the tempo from the time since the last one.
+  unsigned long Interval = Now - B->LastBeat;
+  if((B->Beats > 0) && (Interval <= BEAT_MAX_INTERVAL_US)){
+    B->Intervals[B->IntervalIndex] = Interval;
+    B->IntervalIndex = (B->IntervalIndex + 1) % BEAT_INTERVALS;
+    if(B->IntervalCount < BEAT_INTERVALS){
+      B->IntervalCount++;
+    }
+    if(B->IntervalCount >= 3){
+      B->Bpm = 60000000.0 / BeatInterval(B);
+    }
+  }
+  B->LastBeat = Now;
+  B->Beats++;
+  B->Strength = Flux / Threshold;
+  return true;
+}
@@ -0,0 +1,45 @@
+/*
+    * BeatDetector.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the onset and beat detector. It works on the
+    *  magnitudes the compute stage already has, comparing every frame with the
+    *  one before it (spectral flux), so it needs no FFT of its own.
+    *  Does not depend on the ESP32.
+    *  
+*/
+#ifndef _BEATDETECTOR_H
+#define _BEATDETECTOR_H
+
+#include <stdint.h>
+
+//Defines
+#define BEAT_HISTORY 16                         //Frames of flux the adaptive threshold is taken over
+#define BEAT_SENSITIVITY 1.5                    //Standard deviations above the mean flux an onset has to be
+#define BEAT_MIN_FLUX 0.02                      //Flux below this is never an onset (silence and noise)
+#define BEAT_MIN_INTERVAL_US 300000             //Shortest time between two beats, 200 BPM
+#define BEAT_MAX_INTERVAL_US 1500000            //Longest time between two beats that is used for the BPM, 40 BPM
+#define BEAT_INTERVALS 8                        //Beat intervals the BPM is worked out from
+
+struct BeatDetector{
+  float *Previous;                              //Magnitudes of the last frame, indexed by bin
+  int BinStart;                                 //Bins compared, the others are ignored
+  int BinEnd;
+  bool HasPrevious;                             //False until the first frame was seen
+  float Flux[BEAT_HISTORY];                     //Flux of the last frames, a ring
+  uint8_t FluxIndex;
+  uint8_t FluxCount;
+  float LastFlux;                               //Flux of the frame before, an onset has to be a peak
+  unsigned long LastBeat;                       //Time of the last beat(us)
+  unsigned long Intervals[BEAT_INTERVALS];      //Time between the last beats(us), a ring
+  uint8_t IntervalIndex;
+  uint8_t IntervalCount;
+  unsigned long Beats;                          //Beats detected so far
+  float Bpm;                                    //Beats per minute, 0 until there are enough beats
+  float Strength;                               //Flux of the last beat over its threshold
+};
+
+//Function Prototypes
+void InitializeBeatDetector(BeatDetector *B, float *Previous, int BinStart, int BinEnd);
+bool DetectBeat(BeatDetector *B, const float *Magnitude, unsigned long Now);
+#endif //_BEATDETECTOR_H
@@ -5,6 +5,7 @@
 */
 #include "DisplayFunctions.h"
 #include "SignalSampler.h"
+#include "PitchMap.h"
 
 //Define the glolbal variables 
 int Ymin;
@@ -14,7 +15,6 @@ int Wskip;                                       //Used in plotting the data on
 int DispBufferElements;
 uint16_t screencounter = 1;
 unsigned long frame = 0;
-unsigned long ttime_start = 0; 
 
 
 //Functions
@@ -35,6 +35,46 @@ void TFTsetup(TFT_eSPI &tft){
   tft.setTextSize(1);
 }
 
+/*
+*   Function to draw a run length encoded RGB565 image (see SPALSH_SCREEN.h for the format).
+*   The image is decoded into a small strip buffer and pushed a few rows at a time,
+*   so the uncompressed image never has to exist in memory.
+*   Input: TFT_eSPI &tft - Reference to the TFT screen.
+*          int x, int y - Top left corner of the image.
+*          int w, int h - Size of the image in pixels.
+*          const uint16_t *Data - The encoded tokens.
+*          uint32_t Length - Number of uint16_t words in Data.
+*   Output: None.
+*/
+void DrawRLEImage(TFT_eSPI &tft, int x, int y, int w, int h, const uint16_t *Data, uint32_t Length){
+  static uint16_t Strip[RLE_STRIP_PIXELS];
+  int StripRows = RLE_STRIP_PIXELS / w;
+  int StripPixels = StripRows * w;
+  int Filled = 0;
+  int Row = 0;
+  uint32_t i = 0;
+  while(i < Length && Row < h){
+    uint16_t Token = Data[i++];
+    bool Run = Token & 0x8000;
+    uint16_t Count = Token & 0x7FFF;
+    for(uint16_t k = 0; k < Count && i < Length; k++){
+      Strip[Filled++] = Run? Data[i] : Data[i++];
+      if(Filled == StripPixels){
+        tft.pushImage(x, y + Row, w, StripRows, Strip);
+        Row += StripRows;
+        Filled = 0;
+      }
+    }
+    if(Run){
+      i++;
+    }
+  }
+  //Whatever is left over is less than a full strip.
+  if(Filled >= w){
+    tft.pushImage(x, y + Row, w, Filled / w, Strip);
+  }
+}
+
 /*
 *   Function to initialize the View Scale of the Waveform.
 *   Input: None.
@@ -77,16 +117,28 @@ void SetViewScale(Stream &Serial){
     }
 }
 
+/*
+*   Function to get the number of samples the waveform plot spans, one point every Wskip samples across the box.
+*   SetViewScale() has to be called first.
+*   Input: None.
+*   Output: int - Samples drawn from the first one handed to PlotSampledData().
+*/
+int WaveformWindow(){
+  int Window = BoxW * Wskip;
+  return (Window < DispBufferElements)? Window : DispBufferElements;
+}
+
 /*
 *   Function to plot the sampled data on the TFT screen.
 *   Input: TFT_eSPI &tft - Reference to the TFT screen.
-*   Input: double* AnalogValue_re - Reference to the array to store the sampled data.
+*   Input: double* AnalogValue_re - Reference to the array to store the sampled data, from the first sample to draw (the trigger point). WaveformWindow() samples are read.
 *   Input: double avg - Average of the sampled data.
 *   Input: double fps - The FPS value computed beforehand.
 *   Input: bool printfps - Boolean to indicate if the FPS value should be printed. (1-> print, 0-> print avg)
+*   Input: bool DrawText - Draw the text under the plot, the frame scheduler turns it off under load.
 *   Output: None.
 */
-void PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fps, uint16_t PlotColor){
+void PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fps, uint16_t PlotColor, bool DrawText){
 
   unsigned long timee = micros();       //Legacy code, used to get the time spent in the function
   
@@ -119,16 +171,16 @@ void PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fp
 
   //Plot the sampled data.
   int Xpos = startX;
-  int LineYposStart = map(avg, LowerYcut, UpperYcut, startY+BoxH, startY);      //This is the centre of the waveform
+  int LineYposStart = startY + WaveformRowOf(avg);                               //This is the centre of the waveform
   //These two are used to generate the line plot. As we need 2 set of points.
   int Ylast = startY;
   int Xlast = startX;
 
   //This loop plots the points on the screen.
-  for(int counter = 0; counter < DispBufferElements; counter += Wskip){
+  for(int counter = 0; (counter < DispBufferElements) && (Xpos < startX + BoxW); counter += Wskip){
     
     //get the y cordinate based on the input
-    int Ypos = map(AnalogValue_re[counter], LowerYcut, UpperYcut, startY+BoxH, startY);
+    int Ypos = startY + WaveformRowOf(AnalogValue_re[counter]);
     
     //plot the Signal
     if(PlotType == 1){  //Shaded Graph
@@ -198,12 +250,14 @@ void PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fp
   //tft.drawRect(startX+1, Ymin, BoxW-2, (Ymax-Ymin), TFT_GREEN);   //This is the bounding box of the waveform. Uncomment to visualizise how the program deletes a specific region.
 
   //Now print the text.
-  tft.setCursor(TEXT_startX, TEXT_startY);
-  tft.print((int)fps);    //printing FPS
-  tft.setCursor(TEXT2_startX, TEXT2_startY);
-  tft.print((int)avg);    //printing average value read
-  tft.setCursor(TEXT3_startX, TEXT3_startY);
-  tft.print("WAVEFORM PLOT");
+  if(DrawText){
+    tft.setCursor(TEXT_startX, TEXT_startY);
+    tft.print((int)fps);    //printing FPS
+    tft.setCursor(TEXT2_startX, TEXT2_startY);
+    tft.print((int)avg);    //printing average value read
+    tft.setCursor(TEXT3_startX, TEXT3_startY);
+    tft.print("WAVEFORM PLOT");
+  }
   
   timee = micros() - timee;                 //Calculate the time taken to plot the data.
   // Serial.print("PLOTsTime: ");              //Print the time taken to plot the data.
@@ -211,61 +265,66 @@ void PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fp
 
 }
 
-void  PlotFFTBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, double fps, uint16_t PlotColor){
-  unsigned long timee = micros();       //Legacy code, used to get the time spent in the function
-  //Clear Screen
-  uint16_t SCRCLR = BG_Color;
-  //tft.fillScreen(SCRCLR);
-  //tft.fillRect(startX+1, startY+1, BoxW-2, BoxH-2, SCRCLR);                                     //This is to clear the previous plot
-  tft.fillRect(startX+1, startY + BoxH - MaxBarHeight, BoxW-2, MaxBarHeight, SCRCLR);             //Plot based clear screen, potentially faster.
-  tft.fillRect(TEXT_startX, TEXT_startY, TEXT_WIDTH, TEXT_HEIGHT, SCRCLR);                        //This is to clear the text that prints the average value 
-  //Clear the rest two texts as well.
-  tft.fillRect(TEXT2_startX, TEXT2_startY, TEXT2_WIDTH, TEXT2_HEIGHT, SCRCLR);
-  //tft.fillRect(TEXT3_startX, TEXT3_startY, TEXT3_WIDTH, TEXT3_HEIGHT, SCRCLR);
+/*
+*   Function to plot the FFT bars on the TFT screen, with a marker over the bars of the peaks.
+*   Input: TFT_eSPI &tft - Reference to the TFT object.
+*   Input: uint32_t *DisplayData - The bar heights.
+*   Input: int Channel - Number of bars.
+*   Input: float FPeak - The major frequency, printed under the plot.
+*   Input: double fps - The frame rate.
+*   Input: uint16_t PlotColor - The color of the plot.
+*   Input: bool DrawText - False skips the text, the scheduler turns it off under load.
+*   Input: const uint8_t *Markers - Bars to mark, NULL for none.
+*   Input: int MarkerCount - Number of markers.
+*   Output: None.
+*/
+void  PlotFFTBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, double fps, uint16_t PlotColor, bool DrawText, const uint8_t *Markers, int MarkerCount){
+  static_assert(BAR_GRAPH_INK == TFT_BLACK, "The box and the markers are black");
+  DrawBarGraph(tft, DisplayData, Channel, FPeak, fps, PlotColor, BG_Color, DrawText, Markers, MarkerCount, MaxBarHeight);
+}
 
-  MaxBarHeight = 0;
-  
-  //Now plot the bar graph  200000
+/*
+*   Function to plot the chroma or piano bars from ApplyPitchMap() on the TFT screen.
+*   The bars are drawn by PlotFFTBarGraph(), the text is the note of the fundamental
+*   with how far off it is in cents(tuner), and the note names under the bars.
+*   Input: TFT_eSPI &tft - Reference to the TFT object.
+*   Input: uint32_t *DisplayData - The bar heights.
+*   Input: int Channel - Number of bars.
+*   Input: float FPeak - The fundamental from DetectPitch(), 0 leaves the tuner empty.
+*   Input: int LowestMidi - MIDI number of the first bar of the piano plot.
+*   Input: bool Chroma - True for the 12 pitch classes, false for piano keys.
+*   Input: double fps - The frame rate.
+*   Input: uint16_t PlotColor - The color of the plot.
+*   Input: bool DrawText - False skips the text, the scheduler turns it off under load.
+*   Output: None.
+*/
+void  PlotNoteBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, int LowestMidi, bool Chroma, double fps, uint16_t PlotColor, bool DrawText){
+  PlotFFTBarGraph(tft, DisplayData, Channel, FPeak, fps, PlotColor, false);
+  if(!DrawText){
+    return;
+  }
+  char Name[8];
+  tft.setCursor(TEXT_startX, TEXT_startY);
+  tft.print((int)fps);                          //Print the Framerate
+  //Nearest note to the dominant frequency and its offset in cents
+  if(FPeak > 0){
+    float Midi = FrequencyToMidi(FPeak);
+    int Note = (int)lroundf(Midi);
+    MidiNoteName(Note, true, Name);
+    tft.setCursor(TEXT2_startX, TEXT2_startY);
+    tft.printf("%s%+d", Name, (int)lroundf((Midi - Note) * 100));
+  }
+  //Note names under the bars, every note for chroma and only the Cs for the piano
   uint16_t BarWidth = floor(BoxW / Channel);
-  uint16_t BarHeight = 0;
-  uint16_t Xpos = startX;
-  uint16_t Ypos = startY + BoxH;
   for(int i = 0; i < Channel; i++){
-    if(DisplayData[i] > FFTPLOT_THRESHOLD_UPPER){
-      BarHeight = BoxH;   
+    int Midi = Chroma? i : LowestMidi + i;
+    if(!Chroma && (Midi % PITCH_CLASSES) != 0){
+      continue;
     }
-    else if(DisplayData[i] < FFTPLOT_THRESHOLD_LOWER){
-      BarHeight = 0;
-    }
-    else{
-      BarHeight = map(DisplayData[i], FFTPLOT_THRESHOLD_LOWER, FFTPLOT_THRESHOLD_UPPER, 0, BoxH);
-    }
-    Ypos = Ypos - BarHeight;
-
-    if(BarHeight > MaxBarHeight){
-      MaxBarHeight = BarHeight;
-    }
-    //Serial.printf("%d %d %d %d %d\n",DisplayData[i], Xpos, Ypos, BarWidth, BarHeight);
-    //Now we have the rectangle's starting X and Y, and width and height. draw it.
-    tft.fillRect(Xpos, Ypos, BarWidth, BarHeight, PlotColor);
-
-    //Now increment the Xposition for the next bar.
-    Xpos += BarWidth;
-    Ypos = startY + BoxH;
+    MidiNoteName(Midi, !Chroma, Name);
+    tft.setCursor(startX + i * BarWidth, TEXT3_startY);
+    tft.print(Name);
   }
-    //Draw Box
-  tft.drawRect(startX, startY, BoxW, BoxH, TFT_BLACK);
-    //Now print the text.
-  tft.setCursor(TEXT_startX, TEXT_startY);
-  tft.print((int)fps);                        //Print the Framerate if required.
-  tft.setCursor(TEXT2_startX, TEXT2_startY);
-  tft.print((int)FPeak);                      //Print the dominant frequency
-  tft.setCursor(TEXT3_startX, TEXT3_startY);
-  tft.print("FREQUENCY PLOT");
-  timee = micros() - timee;                   //Calculate the time taken to plot the data.
-//   Serial.print("PLOTsTime: ");             //Print the time taken to plot the data.
-//   Serial.println(timee);  
-//  
 }
 
 /*
@@ -283,34 +342,6 @@ void PrintSampledData(Stream &Serial, float* AnalogValue_re){
     }
 }
 
-/*
-*   Function to get the framerate.
-*   Input: unsigned long* frames - Reference to the variable that stores the number of frames. 
-*   Input: unsigned long startTime - The time at which the program started.
-*   Input: unsigned long timeNow - Current time.
-*   Output: double fps - The framerate.
-*/
-double GetFrameRate(unsigned long timeNow){
-    float fps = 0.0;
-    frame++;    
-    fps = 1.0/((timeNow - ttime_start)*1.0/1000000.0)*(frame);
-    // Serial.print("TimeStart: ");
-    // Serial.println(ttime_start);
-    // Serial.print("TimeNow: ");
-    // Serial.println(timeNow);
-    // Serial.print("Frames genrated: ");
-    // Serial.println(frame);
-    // Serial.print("FPS output: ");
-    // Serial.println(fps);
-    // Serial.println((timeNow - ttime_start)*1.0/1000000.0);
-    // Serial.println(1.0/((timeNow - ttime_start)*1.0/1000000.0)*(frame));
-    if(frame > 100){
-      frame = 0;
-      ttime_start = timeNow;
-    }
-    return fps;
-}
-
 //RGBColor Class Functions
 
 //Constructor
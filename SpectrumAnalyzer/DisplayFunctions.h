@@ -12,6 +12,8 @@
 #include <TFT_eSPI.h>
 #include <Math.h>
 #include <stdio.h>
+#include "PlotScale.h"
+#include "BarGraph.h"
 
 //Defines
 #define PlotType 2                                      //2 for line, 1 for shaded, 0 for line 
@@ -19,62 +21,56 @@
                                                         //1-> Full scale, 2-> half, 3-> 1/4th, 4-> 1/8th, 
                                                         //any other will default to full scale 
 
-#define startX 0                                        //Start X coordinate for display box
-#define startY 0                                        //Start Y coordinate for display box
-#define BoxW 160                                        //Width of display box
-#define BoxH 100                                        //Height of display box
-#define TEXT_startX 0                                   //Start X coordinate for text              
-#define TEXT_startY 105                                 //Start Y coordinate for text
-#define TEXT_WIDTH 20                                   //Width of text box    
-#define TEXT_HEIGHT 10                                  //Height of text box
-//These are parameters for the other text that will
-//printed on the display
-#define TEXT2_startX 120
-#define TEXT2_startY 105
-#define TEXT2_WIDTH 40
-#define TEXT2_HEIGHT 10 
-#define TEXT3_startX 0
-#define TEXT3_startY 116
-#define TEXT3_WIDTH 80
-#define TEXT3_HEIGHT 10
+//startX, startY, BoxW, BoxH and the TEXT boxes, where the plots go, are in PlotScale.h
 ///////////////////////
-#define UpperYcut 2700                                  //Upper cutoff for plotting the sampled data
-#define LowerYcut 000                                   //Lower cutoff for plotting the sampled data
+//UpperYcut and LowerYcut, the range of the waveform plot, are in PlotScale.h
 
-#define FPSdesired 24                                   //Desired FPS for the display(max 30)
-#define FPSDelayMS 1/(FPSdesired*1.0)*1000              //The time we have to wait for between each new frame
+#define FPSdesired 24                                   //Desired FPS for the display(max 30), paced by the FrameScheduler, no faster than the captures
 #define CLRSCREENCNTR 500                               //Reset Full screen after this many frames
 
-#define FFTPLOT_CHANNEL 80                              //The channels on the FFF plot
-#define FFTPLOT_FREQ_START 50                          //The starting frequency for the FFT plot
-#define FFTPLOT_FREQ_END 4500                          //The ending frequency for the FFT plot
-#define FFTPLOT_THRESHOLD_LOWER 0
-#define FFTPLOT_THRESHOLD_UPPER 80000
+//FFTPLOT_CHANNEL, FFTPLOT_FREQ_START/END and FFTPLOT_THRESHOLD_LOWER/UPPER, the bars and their range, are in PlotScale.h
+
+#define PEAK_MARKERS 1                                  //Setting this to 1 marks the bars of the strongest peaks(partials) on the FFT plot
 
 #define ColorChangeThreshold 1                          //The Speed at which FFT spectrum plot change color
 #define Rainbow 1                                       //If we want to cycle the color of RGB plot(1). O/W plot will be a set color(0).
+#define RainbowOnBeat 1                                 //With Rainbow, the FFT plot color jumps ahead on every beat(1) instead of every ColorChangeThreshold frames(0)
+#define BeatColorSteps 8                                //Rainbow steps taken on a beat
 #define BG_Color  TFT_WHITE//0x5269                                //BG Color for all plots
 #define FFTPLOT_DEFAULT_COLOR TFT_WHITE                 //Default color of the Plot
 
+#define SPLASH_MIN_TIME 1500                            //The splash stays up at least this long(ms), setup runs behind it
+#define RLE_STRIP_PIXELS 1280                           //Size of the strip buffer used to decode the splash(8 rows of 160)
+
 #define PUSH_BUTTON_PIN 22                              //The pin that is connceted to push button to toggle Plot Mode
 
+//The plots the button cycles through
+enum PlotModes{
+  PLOT_WAVEFORM,                                        //Sampled data
+  PLOT_FFT,                                             //FFT bars, FFTPLOT_FREQ_START to FFTPLOT_FREQ_END
+  PLOT_MULTIRES,                                        //Log spaced bars from a long FFT for the bass and a short one for the treble, not with DUAL_CHANNEL
+  PLOT_CHROMA,                                          //FFT folded into the 12 pitch classes
+  PLOT_PIANO,                                           //FFT folded into piano keys
+  PLOT_MODE_COUNT
+};
+
 //Global Variables
-const   int FPSDelay = ceil(FPSDelayMS);                //The Delay in Milliseconds between each new frame.
 extern  int Wskip;                                      //Used in plotting the data on the screen. 
 extern  int DispBufferElements;                         //Number of elements in the display buffer, used in plotting function
 extern  int Ymax;                                       //Used in plotting the sampled data
 extern  int Ymin;                                       //Used in plotting the sampled data
 extern  int MaxBarHeight;
 extern  unsigned long frame;                            //Used to keep track of how many frames have been displayed                                        
-extern  unsigned long ttime_start;                      //Used to keep track of how long the program has been running
 
 //Function Prototypes
 void    TFTsetup(TFT_eSPI &tft);
+void    DrawRLEImage(TFT_eSPI &tft, int x, int y, int w, int h, const uint16_t *Data, uint32_t Length);
 void    SetViewScale(Stream &Serial);
-void    PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fps, uint16_t PlotColor);
+int     WaveformWindow();
+void    PlotSampledData(TFT_eSPI &tft, float* AnalogValue_re, double avg, double fps, uint16_t PlotColor, bool DrawText = true);
 void    PrintSampledData(Stream &Serial, float* AnalogValue_re);
-double  GetFrameRate(unsigned long timeNow);
-void    PlotFFTBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, double fps, uint16_t PlotColor);
+void    PlotFFTBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, double fps, uint16_t PlotColor, bool DrawText = true, const uint8_t *Markers = NULL, int MarkerCount = 0);
+void    PlotNoteBarGraph(TFT_eSPI &tft, uint32_t *DisplayData, int Channel, float FPeak, int LowestMidi, bool Chroma, double fps, uint16_t PlotColor, bool DrawText = true);
 
 //Structure for keeping track of Button Presses
 struct Button{
@@ -0,0 +1,274 @@
+/*
+*   EventRecorder.cpp
+*   Created on: Oct 19, 2026
+*   Delta + Rice coded ring of the last captures, frozen by an event for download.
+*/
+#include "EventRecorder.h"
+#include <math.h>
+
+//Functions
+
+/*
+*   Function to round a sample to a whole number from 0 to EVENT_SAMPLE_MAX.
+*   Input: float x - The sample.
+*   Output: int - The stored value.
+*/
+static inline int Quantize(float x){
+  int Value = (int)(x + 0.5f);
+  return (Value < 0)? 0 : ((Value > EVENT_SAMPLE_MAX)? EVENT_SAMPLE_MAX : Value);
+}
+
+/*
+*   Function to map a signed difference to an unsigned one, 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+*   Input: int d - The difference.
+*   Output: uint32_t - The zigzag value, at most EVENT_ESCAPE_BITS bits.
+*/
+static inline uint32_t ZigZag(int d){
+  return (d >= 0)? 2 * (uint32_t)d : 2 * (uint32_t)(-d) - 1;
+}
+
+/*
+*   Function to set up the recorder with an empty ring.
+*   Input: EventRecorder *R - The recorder.
+*   Input: uint8_t *Ring - Memory for the compressed captures.
+*   Input: uint32_t Size - Bytes in Ring.
+*   Output: None.
+*/
+void InitializeEventRecorder(EventRecorder *R, uint8_t *Ring, uint32_t Size){
+  R->Ring = Ring;
+  R->Size = Size;
+  R->SamplesIn = 0;
+  R->BytesOut = 0;
+  R->Recorded.store(0);
+  R->Frozen.store(true);                        //Held while the ring is reset
+  ReleaseEvent(R);
+}
+
+/*
+*   Function to add a capture to the ring, the oldest captures are dropped to make room.
+*   1. The Rice parameter comes from the mean zigzag difference, about log2 of it.
+*   2. The exact size is worked out, so the oldest blocks can be dropped before anything is written.
+*   3. Every difference is written as its quotient in unary (ones and a zero) and the low Rice bits.
+*      A quotient of EVENT_RICE_ESCAPE or more is written as that many ones and the raw zigzag value.
+*   Once EVENT_POST_BLOCKS captures have been recorded after an event, the ring is frozen.
+*   Costs three short passes over the samples, a few microseconds per thousand samples.
+*   Input: EventRecorder *R - The recorder. Only one task may record.
+*   Input: const float *Samples - The capture, ADC values.
+*   Input: int Count - Number of samples, at most 65535.
+*   Input: unsigned long Sequence - Capture number.
+*   Output: int - Bytes the capture took, 0 if it was not recorded (frozen, or larger than the ring).
+*/
+int RecordCapture(EventRecorder *R, const float *Samples, int Count, unsigned long Sequence){
+  if(R->Frozen.load(std::memory_order_acquire) || Count <= 0){
+    return 0;
+  }
+  //1. Rice parameter, the largest k with 2^(k+1) at most the mean.
+  uint32_t Sum = 0;
+  int Prev = Quantize(Samples[0]);
+  for(int i = 1; i < Count; i++){
+    int x = Quantize(Samples[i]);
+    Sum += ZigZag(x - Prev);
+    Prev = x;
+  }
+  uint8_t k = 0;
+  while(k < EVENT_MAX_RICE && ((uint32_t)(Count - 1) << (k + 1)) <= Sum){
+    k++;
+  }
+
+  //2. Exact size, then room for it.
+  uint32_t Bits = 0;
+  Prev = Quantize(Samples[0]);
+  for(int i = 1; i < Count; i++){
+    int x = Quantize(Samples[i]);
+    uint32_t q = ZigZag(x - Prev) >> k;
+    Bits += (q < EVENT_RICE_ESCAPE)? q + 1 + k : EVENT_RICE_ESCAPE + EVENT_ESCAPE_BITS;
+    Prev = x;
+  }
+  uint32_t Bytes = (Bits + 7) / 8;
+  if(Bytes > R->Size){
+    return 0;
+  }
+  while(R->Count == EVENT_MAX_BLOCKS || R->Used + Bytes > R->Size){
+    R->Used -= R->Blocks[R->Oldest].Bytes;
+    R->Oldest = (R->Oldest + 1) % EVENT_MAX_BLOCKS;
+    R->Count--;
+  }
+  EventBlock *B = &R->Blocks[(R->Oldest + R->Count) % EVENT_MAX_BLOCKS];
+  B->Start = R->WriteAt;
+  B->Bytes = Bytes;
+  B->Sequence = Sequence;
+  B->Count = Count;
+  B->First = Quantize(Samples[0]);
+  B->Rice = k;
+
+  //3. Codes go through a 64 bit accumulator, whole bytes are moved into the ring.
+  uint64_t Acc = 0;
+  int AccBits = 0;
+  uint32_t At = R->WriteAt;
+  Prev = B->First;
+  for(int i = 1; i < Count; i++){
+    int x = Quantize(Samples[i]);
+    uint32_t z = ZigZag(x - Prev);
+    uint32_t q = z >> k;
+    if(q < EVENT_RICE_ESCAPE){
+      Acc = (Acc << (q + 1 + k)) | ((((1u << q) - 1) << 1) << k) | (z & ((1u << k) - 1));
+      AccBits += q + 1 + k;
+    }
+    else{
+      Acc = (Acc << (EVENT_RICE_ESCAPE + EVENT_ESCAPE_BITS)) | ((uint64_t)((1u << EVENT_RICE_ESCAPE) - 1) << (EVENT_ESCAPE_BITS)) | z;
+      AccBits += EVENT_RICE_ESCAPE + EVENT_ESCAPE_BITS;
+    }
+    while(AccBits >= 8){
+      AccBits -= 8;
+      R->Ring[At] = (uint8_t)(Acc >> AccBits);
+      At = (At + 1 == R->Size)? 0 : At + 1;
+    }
+    Prev = x;
+  }
+  if(AccBits > 0){
+    R->Ring[At] = (uint8_t)(Acc << (8 - AccBits));
+    At = (At + 1 == R->Size)? 0 : At + 1;
+  }
+  R->WriteAt = At;
+  R->Used += Bytes;
+  R->Count++;
+  R->SamplesIn += Count;
+  R->BytesOut += Bytes;
+  R->Recorded.store(Sequence);
+
+  unsigned long Event = R->EventSequence.load(std::memory_order_acquire);
+  if(Event != 0 && (long)(Sequence - Event) >= EVENT_POST_BLOCKS){
+    R->Frozen.store(true, std::memory_order_release);
+  }
+  return Bytes;
+}
+
+/*
+*   Function to report an event, safe to call from any task. Only the first event counts until the ring is released.
+*   Input: EventRecorder *R - The recorder.
+*   Input: unsigned long Sequence - Capture the event was seen in, not 0.
+*   Output: None.
+*/
+void TriggerEvent(EventRecorder *R, unsigned long Sequence){
+  unsigned long None = 0;
+  R->EventSequence.compare_exchange_strong(None, Sequence);
+}
+
+/*
+*   Function to empty the ring and start recording again. Only call it while the ring is frozen,
+*   then the recording task is not touching the ring.
+*   Input: EventRecorder *R - The recorder.
+*   Output: None.
+*/
+void ReleaseEvent(EventRecorder *R){
+  if(!R->Frozen.load(std::memory_order_acquire)){
+    return;
+  }
+  R->WriteAt = 0;
+  R->Used = 0;
+  R->Oldest = 0;
+  R->Count = 0;
+  R->EventSequence.store(0);
+  R->Frozen.store(false, std::memory_order_release);
+}
+
+/*
+*   Function to decode a capture of the ring.
+*   Input: const EventRecorder *R - The recorder.
+*   Input: int Index - The capture, 0 is the oldest.
+*   Input: int16_t *Samples - Set to the samples of the capture, room for its Count samples.
+*   Output: int - Number of samples, 0 if there is no such capture.
+*/
+int DecodeEventBlock(const EventRecorder *R, int Index, int16_t *Samples){
+  if(Index < 0 || Index >= R->Count){
+    return 0;
+  }
+  const EventBlock *B = &R->Blocks[(R->Oldest + Index) % EVENT_MAX_BLOCKS];
+  uint32_t At = B->Start;
+  uint32_t Acc = 0;
+  int AccBits = 0;
+  int Prev = B->First;
+  Samples[0] = B->First;
+  for(int i = 1; i < B->Count; i++){
+    //Unary quotient, a bit at a time, the bytes are pulled in as they are needed.
+    uint32_t q = 0;
+    while(true){
+      if(AccBits < 24){
+        Acc = (Acc << 8) | R->Ring[At];
+        At = (At + 1 == R->Size)? 0 : At + 1;
+        AccBits += 8;
+        continue;
+      }
+      if(((Acc >> (AccBits - 1)) & 1) == 0 || q == EVENT_RICE_ESCAPE){
+        break;
+      }
+      q++;
+      AccBits--;
+    }
+    uint32_t z;
+    if(q == EVENT_RICE_ESCAPE){
+      AccBits -= EVENT_ESCAPE_BITS;
+      z = (Acc >> AccBits) & ((1u << (EVENT_ESCAPE_BITS)) - 1);
+    }
+    else{
+      AccBits--;                                //The terminating zero
+      AccBits -= B->Rice;
+      z = (q << B->Rice) | ((Acc >> AccBits) & ((1u << B->Rice) - 1));
+    }
+    int d = (z & 1)? -(int)((z + 1) >> 1) : (int)(z >> 1);
+    Prev += d;
+    Samples[i] = Prev;
+  }
+  return B->Count;
+}
+
+/*
+*   Function to get how far the capture strays from its average.
+*   Input: const float *Samples - The capture.
+*   Input: int Count - Number of samples.
+*   Input: float Average - Average of the capture.
+*   Output: float - The largest distance of a sample from the average(ADC counts).
+*/
+float PeakDeviation(const float *Samples, int Count, float Average){
+  float Peak = 0;
+  for(int i = 0; i < Count; i++){
+    float d = fabsf(Samples[i] - Average);
+    Peak = (d > Peak)? d : Peak;
+  }
+  return Peak;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to print the state of the recorder, and the recorded samples, to the Serial object.
+*   The samples are printed one capture per block, 16 to a line, so they can be pasted into a spreadsheet.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const EventRecorder *R - The recorder.
+*   Input: int16_t *Scratch - Room for the samples of one capture, only used with Samples.
+*   Input: bool Samples - Print the samples as well.
+*   Output: None.
+*/
+void PrintEventRecorder(Stream &Serial, const EventRecorder *R, int16_t *Scratch, bool Samples){
+  unsigned long Recorded = 0;
+  for(int i = 0; i < R->Count; i++){
+    Recorded += R->Blocks[(R->Oldest + i) % EVENT_MAX_BLOCKS].Count;
+  }
+  Serial.println("----Event Recorder----");
+  Serial.printf("%s, event at capture %lu, %d captures held, %lu samples in %u of %u bytes\n", R->Frozen.load()? "Frozen" : "Recording",
+                R->EventSequence.load(), R->Count, Recorded, (unsigned)R->Used, (unsigned)R->Size);
+  Serial.printf("%.2f bits per sample since boot\n", (R->SamplesIn > 0)? 8.0 * R->BytesOut / R->SamplesIn : 0.0);
+  if(!Samples){
+    return;
+  }
+  for(int i = 0; i < R->Count; i++){
+    const EventBlock *B = &R->Blocks[(R->Oldest + i) % EVENT_MAX_BLOCKS];
+    Serial.printf("#Capture %lu, %u samples, rice %u\n", B->Sequence, B->Count, B->Rice);
+    int Count = DecodeEventBlock(R, i, Scratch);
+    for(int n = 0; n < Count; n++){
+      Serial.print(Scratch[n]);
+      Serial.print((n % 16 == 15 || n == Count - 1)? '\n' : ',');
+    }
+  }
+  Serial.println("----Event Recorder Finished----");
+}
+#endif
@@ -0,0 +1,69 @@
+/*
+    * EventRecorder.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the event recorder. It keeps the last seconds of
+    *  the main input in a RAM ring, every capture compressed without loss:
+    *  the difference to the sample before is Rice coded, which takes a 12 bit
+    *  sample down to a few bits when it is quiet and 8 to 10 when it is loud. An event (a loud sample or an onset) freezes
+    *  the ring a few captures later, so the history before and after the
+    *  event can be downloaded over serial.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _EVENTRECORDER_H
+#define _EVENTRECORDER_H
+
+#include <stdint.h>
+#include <atomic>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define EVENT_HISTORY_BYTES 16384               //Size of the compressed ring, about 1.2 s of a loud input or a few seconds of a quiet one at 11 kHz
+#define EVENT_MAX_BLOCKS 64                     //Captures the ring can hold at most, however well they compress
+#define EVENT_POST_BLOCKS 4                     //Captures recorded after the event before the ring is frozen
+#define EVENT_LEVEL 1000.0                      //A sample this far(ADC counts) from the average is an event
+#define EVENT_ON_ONSET 1                        //Setting this to 1 makes every onset of the beat detector an event as well
+#define EVENT_SAMPLE_MAX 4096                   //Samples are stored as whole numbers from 0 to this, ConvertSampledData() gives 1 to 4096
+#define EVENT_ESCAPE_BITS 14                    //Bits of a raw zigzag difference, enough for +-EVENT_SAMPLE_MAX
+#define EVENT_RICE_ESCAPE 16                    //A quotient this large is sent as the raw zigzag difference instead
+#define EVENT_MAX_RICE 12                       //Largest Rice parameter
+
+//One compressed capture in the ring
+struct EventBlock{
+  uint32_t Start;                               //First byte in the ring
+  uint32_t Bytes;
+  unsigned long Sequence;                       //Capture number
+  uint16_t Count;                               //Samples
+  uint16_t First;                               //First sample, the others are differences
+  uint8_t Rice;                                 //Rice parameter of the differences
+};
+
+struct EventRecorder{
+  uint8_t *Ring;
+  uint32_t Size;                                //Bytes in the ring
+  uint32_t WriteAt;                             //Next byte to write
+  uint32_t Used;                                //Bytes held by the blocks
+  EventBlock Blocks[EVENT_MAX_BLOCKS];          //A ring of blocks, oldest first from Oldest
+  int Oldest;
+  int Count;
+  std::atomic<unsigned long> EventSequence;     //Capture the event was seen in, 0 if there is none. Written by any task.
+  std::atomic<bool> Frozen;                     //The ring holds an event and is not written until released
+  std::atomic<unsigned long> Recorded;          //Capture number of the newest capture
+  unsigned long SamplesIn;                      //Samples recorded so far
+  unsigned long BytesOut;                       //Bytes they took
+};
+
+//Function Prototypes
+void  InitializeEventRecorder(EventRecorder *R, uint8_t *Ring, uint32_t Size);
+int   RecordCapture(EventRecorder *R, const float *Samples, int Count, unsigned long Sequence);
+void  TriggerEvent(EventRecorder *R, unsigned long Sequence);
+void  ReleaseEvent(EventRecorder *R);
+int   DecodeEventBlock(const EventRecorder *R, int Index, int16_t *Samples);
+float PeakDeviation(const float *Samples, int Count, float Average);
+#ifdef ARDUINO
+void  PrintEventRecorder(Stream &Serial, const EventRecorder *R, int16_t *Scratch, bool Samples);
+#endif
+#endif //_EVENTRECORDER_H
@@ -53,6 +53,7 @@ typedef enum
 
 #define FFT_OWN_INPUT_MEM 1
 #define FFT_OWN_OUTPUT_MEM 2
+#define FFT_STATIC_MEM 4
 
 typedef struct
 {
@@ -65,8 +66,19 @@ typedef struct
   unsigned int flags; // FFT flags
 } fft_config_t;
 
+typedef struct
+{
+  int size;  // real FFT size
+  int bin_start;  // first output bin that is computed
+  int bin_end;  // last output bin that is computed (inclusive)
+  int full_size;  // sub-transforms of this size and smaller need all their outputs
+  unsigned char *masks;  // needed outputs of every sub-transform size, see rfft_pruned_init
+  float *twiddle_factors;  // pointer to buffer holding twiddle factors
+} fft_pruned_plan_t;
+
 
 fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, float *input, float *output);
+fft_config_t *fft_init_static(fft_config_t *config, float *twiddle_factors, int size, fft_type_t type, fft_direction_t direction, float *input, float *output);
 void fft_destroy(fft_config_t *config);
 void fft_execute(fft_config_t *config);
 void fft(float *input, float *output, float *twiddle_factors, int n);
@@ -75,14 +87,49 @@ void rfft(float *x, float *y, float *twiddle_factors, int n);
 void irfft(float *x, float *y, float *twiddle_factors, int n);
 void fft_primitive(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
 void split_radix_fft(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
+void split_radix_fft_fixed(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
+void split_radix_butterfly0(float *y, int n);
+void split_radix_butterfly(float *y, int n, int k, float c1, float s1, float c2, float s2);
+void split_radix_combine(float *y, int n, float *twiddle_factors, int tw_stride);
 void ifft_primitive(float *input, float *output, int n, int stride, float *twiddle_factors, int tw_stride);
 void fft8(float *input, int stride_in, float *output, int stride_out);
+int rfft_pruned_mask_size(int n);
+fft_pruned_plan_t *rfft_pruned_init(fft_pruned_plan_t *plan, unsigned char *masks, float *twiddle_factors, int n, int bin_start, int bin_end);
+void rfft_pruned(float *x, float *y, const fft_pruned_plan_t *plan);
+void rfft_pruned_post(float *y, float *twiddle_factors, int n, int b_start, int b_end);
+void split_radix_fft_pruned(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride, const fft_pruned_plan_t *plan);
 void fft4(float *input, int stride_in, float *output, int stride_out);
+int fft_bitrev_init(unsigned short *table, int n);
+void fft_inplace(float *x, int n, float *twiddle_factors, int tw_stride, const unsigned short *bitrev, int pairs);
+void rfft_inplace(float *x, float *twiddle_factors, int n, const unsigned short *bitrev, int pairs);
 
 
 #define TWO_PI 6.28318530
+// Both can be overridden from the compiler command line, e.g. -DUSE_SPLIT_RADIX=0
+#ifndef USE_SPLIT_RADIX
 #define USE_SPLIT_RADIX 1
+#endif
+#ifndef LARGE_BASE_CASE
 #define LARGE_BASE_CASE 1
+#endif
+// Split-radix transforms go through the size-specialized codelets, needs USE_SPLIT_RADIX
+#ifndef USE_FFT_CODELETS
+#define USE_FFT_CODELETS 1
+#endif
+// Largest transform that is unrolled into one straight-line codelet
+#ifndef FFT_CODELET_MAX
+#define FFT_CODELET_MAX 64
+#endif
+#if USE_FFT_CODELETS
+#define SPLIT_RADIX_KERNEL split_radix_fft_fixed
+#else
+#define SPLIT_RADIX_KERNEL split_radix_fft
+#endif
+#if defined(__GNUC__)
+#define FFT_FLATTEN __attribute__((flatten))
+#else
+#define FFT_FLATTEN
+#endif
 
 
 
@@ -153,8 +200,45 @@ inline fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t directi
   return config;
 }
 
+inline fft_config_t *fft_init_static(fft_config_t *config, float *twiddle_factors, int size, fft_type_t type, fft_direction_t direction, float *input, float *output)
+{
+  /*
+   * Prepare an FFT of correct size and types without touching the heap.
+   *
+   * The caller provides the configuration, a twiddle buffer of 2 * size
+   * floats and the input and output buffers.
+   */
+  int k,m;
+
+  // Check if the size is a power of two
+  if ((size & (size-1)) != 0 || input == NULL || output == NULL)
+    return NULL;
+
+  config->flags = FFT_STATIC_MEM;
+  config->type = type;
+  config->direction = direction;
+  config->size = size;
+  config->input = input;
+  config->output = output;
+  config->twiddle_factors = twiddle_factors;
+
+  float two_pi_by_n = TWO_PI / config->size;
+
+  for (k = 0, m = 0 ; k < config->size ; k++, m+=2)
+  {
+    config->twiddle_factors[m] = cosf(two_pi_by_n * k);    // real
+    config->twiddle_factors[m+1] = sinf(two_pi_by_n * k);  // imag
+  }
+
+  return config;
+}
+
 inline void fft_destroy(fft_config_t *config)
 {
+  // Nothing to release if the caller owns all the memory
+  if (config->flags & FFT_STATIC_MEM)
+    return;
+
   if (config->flags & FFT_OWN_INPUT_MEM)
     free(config->input);
 
@@ -196,7 +280,7 @@ inline void fft(float *input, float *output, float *twiddle_factors, int n)
    */
 
 #if USE_SPLIT_RADIX
-  split_radix_fft(input, output, n, 2, twiddle_factors, 2);
+  SPLIT_RADIX_KERNEL(input, output, n, 2, twiddle_factors, 2);
 #else
   fft_primitive(input, output, n, 2, twiddle_factors, 2);
 #endif
@@ -227,7 +311,7 @@ inline void rfft(float *x, float *y, float *twiddle_factors, int n)
 
   // This code uses the two-for-the-price-of-one strategy
 #if USE_SPLIT_RADIX
-  split_radix_fft(x, y, n / 2, 2, twiddle_factors, 4);
+  SPLIT_RADIX_KERNEL(x, y, n / 2, 2, twiddle_factors, 4);
 #else
   fft_primitive(x, y, n / 2, 2, twiddle_factors, 4);
 #endif
@@ -434,8 +518,6 @@ inline void split_radix_fft(float *x, float *y, int n, int stride, float *twiddl
    *  tw_stride (int)
    *    The number of elements to skip between two successive twiddle factors
    */
-  int k;
-
 #if LARGE_BASE_CASE
   // End condition, stop at n=2 to avoid one trivial recursion
   if (n == 8)
@@ -472,10 +554,19 @@ inline void split_radix_fft(float *x, float *y, int n, int stride, float *twiddl
   split_radix_fft(x + 3 * stride, y + n + n / 2, n / 4, 4 * stride, twiddle_factors, 4 * tw_stride);
 
   // Stitch together the output
+  split_radix_combine(y, n, twiddle_factors, tw_stride);
+
+}
+
+inline void split_radix_butterfly0(float *y, int n)
+{
+  /*
+   * The k = 0 butterfly of the split-radix stitch, it has no twiddle multiplications.
+   * y holds the outputs of the three sub-transforms of a size n transform, as left by split_radix_fft.
+   */
   float u1r, u1i, u2r, u2i, x1r, x1i, x2r, x2i;
   float t;
 
-  // We can save a few multiplications in the first step
   u1r = y[0];
   u1i = y[1];
   u2r = y[n / 2];
@@ -501,9 +592,538 @@ inline void split_radix_fft(float *x, float *y, int n, int stride, float *twiddl
   t = x1r - x2r;
   y[n / 2 + 1] = u2i - t;
   y[n + n / 2 + 1] = u2i + t;
+}
+
+inline void split_radix_butterfly(float *y, int n, int k, float c1, float s1, float c2, float s2)
+{
+  /*
+   * Butterfly k of the split-radix stitch, outputs k, k + n/4, k + n/2 and k + 3n/4.
+   * (c1, s1) is the twiddle factor of k and (c2, s2) the one of 3k.
+   */
+  float u1r, u1i, u2r, u2i, x1r, x1i, x2r, x2i;
+  float t;
+
+  u1r = y[2 * k];
+  u1i = y[2 * k + 1];
+  u2r = y[2 * k + n / 2];
+  u2i = y[2 * k + n / 2 + 1];
+
+  x1r =  c1 * y[n + 2 * k] + s1 * y[n + 2 * k + 1];
+  x1i = -s1 * y[n + 2 * k] + c1 * y[n + 2 * k + 1];
+  x2r =  c2 * y[n / 2 + n + 2 * k] + s2 * y[n / 2 + n + 2 * k + 1];
+  x2i = -s2 * y[n / 2 + n + 2 * k] + c2 * y[n / 2 + n + 2 * k + 1];
+
+  t = x1r + x2r;
+  y[2 * k]     = u1r + t;
+  y[2 * k + n]     = u1r - t;
+
+  t = x1i + x2i;
+  y[2 * k + 1] = u1i + t;
+  y[2 * k + n + 1] = u1i - t;
+
+  t = x2i - x1i;
+  y[2 * k + n / 2]     = u2r - t;
+  y[2 * k + n + n / 2]     = u2r + t;
+
+  t = x1r - x2r;
+  y[2 * k + n / 2 + 1] = u2i - t;
+  y[2 * k + n + n / 2 + 1] = u2i + t;
+}
+
+inline void split_radix_combine(float *y, int n, float *twiddle_factors, int tw_stride)
+{
+  /*
+   * Stitch the three sub-transforms of a size n split-radix transform together.
+   */
+  int k;
+
+  // We can save a few multiplications in the first step
+  split_radix_butterfly0(y, n);
+
+  for (k = 1 ; k < n / 4 ; k++)
+    split_radix_butterfly(y, n, k, twiddle_factors[k * tw_stride], twiddle_factors[k * tw_stride + 1],
+                          twiddle_factors[3 * k * tw_stride], twiddle_factors[3 * k * tw_stride + 1]);
+}
+
+/*
+ * Size-specialized split-radix FFT
+ * ================================
+ *
+ * The same transform as split_radix_fft, with the size a template argument.
+ * Transforms of FFT_CODELET_MAX points and less are codelets: the recursion
+ * and the stitch loops are unrolled at compile time, down to fft8 and fft4,
+ * and the whole codelet is flattened into one straight-line function. Larger
+ * sizes are a chain of functions fixed at compile time, one per size, so
+ * there are no size checks at run time and every loop bound is a constant.
+ * split_radix_fft_fixed picks the chain for the size at run time.
+ */
+
+// Taylor series of cos and sin, evaluated by the compiler for the twiddle factors of the codelets
+constexpr double fft_cos_series(double x2, double term, int i)
+{
+  return (i > 24) ? 0.0 : term + fft_cos_series(x2, -term * x2 / ((2 * i + 1) * (2 * i + 2)), i + 1);
+}
+
+constexpr double fft_sin_series(double x2, double term, int i)
+{
+  return (i > 24) ? 0.0 : term + fft_sin_series(x2, -term * x2 / ((2 * i + 2) * (2 * i + 3)), i + 1);
+}
+
+constexpr double fft_cos(double x)
+{
+  return fft_cos_series(x * x, 1.0, 0);
+}
+
+constexpr double fft_sin(double x)
+{
+  return x * fft_sin_series(x * x, 1.0, 0);
+}
+
+template <int N, int K, bool Done = (K >= N / 4)>
+struct fft_codelet_combine
+{
+  // Butterflies K to N/4 - 1 of the stitch, one after the other. The twiddle factors
+  // of a size N transform are W_N^K and W_N^3K whatever table the caller has, so they are constants.
+  static inline void run(float *y)
+  {
+    split_radix_butterfly(y, N, K, (float)fft_cos(6.283185307179586 * K / N), (float)fft_sin(6.283185307179586 * K / N),
+                          (float)fft_cos(6.283185307179586 * 3 * K / N), (float)fft_sin(6.283185307179586 * 3 * K / N));
+    fft_codelet_combine<N, K + 1>::run(y);
+  }
+};
+
+template <int N, int K>
+struct fft_codelet_combine<N, K, true>
+{
+  static inline void run(float *) {}
+};
+
+template <int N>
+struct fft_codelet
+{
+  // Split-radix transform of N points, unrolled
+  static inline void run(float *x, int stride, float *y, float *twiddle_factors, int tw_stride)
+  {
+    fft_codelet<N / 2>::run(x, 2 * stride, y, twiddle_factors, 2 * tw_stride);
+    fft_codelet<N / 4>::run(x + stride, 4 * stride, y + N, twiddle_factors, 4 * tw_stride);
+    fft_codelet<N / 4>::run(x + 3 * stride, 4 * stride, y + N + N / 2, twiddle_factors, 4 * tw_stride);
+    split_radix_butterfly0(y, N);
+    fft_codelet_combine<N, 1>::run(y);
+  }
+};
+
+template <>
+struct fft_codelet<8>
+{
+  static inline void run(float *x, int stride, float *y, float *, int)
+  {
+    fft8(x, stride, y, 2);
+  }
+};
+
+template <>
+struct fft_codelet<4>
+{
+  static inline void run(float *x, int stride, float *y, float *, int)
+  {
+    fft4(x, stride, y, 2);
+  }
+};
+
+template <int N, bool Codelet = (N <= FFT_CODELET_MAX)>
+struct fft_fixed
+{
+  // Split-radix transform of N points, the sub-transforms are fixed at compile time
+  static void run(float *x, int stride, float *y, float *twiddle_factors, int tw_stride)
+  {
+    fft_fixed<N / 2>::run(x, 2 * stride, y, twiddle_factors, 2 * tw_stride);
+    fft_fixed<N / 4>::run(x + stride, 4 * stride, y + N, twiddle_factors, 4 * tw_stride);
+    fft_fixed<N / 4>::run(x + 3 * stride, 4 * stride, y + N + N / 2, twiddle_factors, 4 * tw_stride);
+    split_radix_combine(y, N, twiddle_factors, tw_stride);
+  }
+};
+
+template <int N>
+struct fft_fixed<N, true>
+{
+  FFT_FLATTEN static void run(float *x, int stride, float *y, float *twiddle_factors, int tw_stride)
+  {
+    fft_codelet<N>::run(x, stride, y, twiddle_factors, tw_stride);
+  }
+};
+
+inline void split_radix_fft_fixed(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride)
+{
+  /*
+   * Same parameters and result as split_radix_fft. Sizes 16 to 4096 run the
+   * size-specialized transform, other sizes fall back to split_radix_fft.
+   */
+  switch (n)
+  {
+    case 16:   fft_fixed<16>::run(x, stride, y, twiddle_factors, tw_stride);   break;
+    case 32:   fft_fixed<32>::run(x, stride, y, twiddle_factors, tw_stride);   break;
+    case 64:   fft_fixed<64>::run(x, stride, y, twiddle_factors, tw_stride);   break;
+    case 128:  fft_fixed<128>::run(x, stride, y, twiddle_factors, tw_stride);  break;
+    case 256:  fft_fixed<256>::run(x, stride, y, twiddle_factors, tw_stride);  break;
+    case 512:  fft_fixed<512>::run(x, stride, y, twiddle_factors, tw_stride);  break;
+    case 1024: fft_fixed<1024>::run(x, stride, y, twiddle_factors, tw_stride); break;
+    case 2048: fft_fixed<2048>::run(x, stride, y, twiddle_factors, tw_stride); break;
+    case 4096: fft_fixed<4096>::run(x, stride, y, twiddle_factors, tw_stride); break;
+    default:   split_radix_fft(x, y, n, stride, twiddle_factors, tw_stride);    break;
+  }
+}
+
+
+inline int fft_bitrev_init(unsigned short *table, int n)
+{
+  /*
+   * Precompute the bit-reversal permutation of a size n transform for fft_inplace.
+   *
+   * Only the pairs (i, j) with i < j are stored, indices that map onto themselves
+   * are left out, so every pair is swapped once.
+   *
+   * Parameters
+   * ----------
+   *  table (unsigned short *)
+   *    Memory for the pairs, n entries (two per pair, there are at most n / 2 pairs)
+   *  n (int)
+   *    The complex FFT size, a power of 2 from 2 to 65536
+   *
+   * Returns the number of pairs.
+   */
+  int bits = 0, pairs = 0;
+  int i, j, b;
+
+  while ((1 << bits) < n)
+    bits++;
+
+  for (i = 0 ; i < n ; i++)
+  {
+    j = 0;
+    for (b = 0 ; b < bits ; b++)
+      if (i & (1 << b))
+        j |= 1 << (bits - 1 - b);
+    if (i < j)
+    {
+      table[2 * pairs] = i;
+      table[2 * pairs + 1] = j;
+      pairs++;
+    }
+  }
+  return pairs;
+}
+
+inline void fft_inplace(float *x, int n, float *twiddle_factors, int tw_stride, const unsigned short *bitrev, int pairs)
+{
+  /*
+   * Forward fast Fourier transform written over its input
+   * DIT, radix-2, iterative in-place implementation
+   *
+   * The samples are put in bit-reversed order with the precomputed table,
+   * then every stage combines pairs of half-size transforms in place.
+   *
+   * Parameters
+   * ----------
+   *  x (float *)
+   *    The complex samples, real/imaginary parts interleaved, replaced by the transform
+   *  n (int)
+   *    The FFT size, a power of 2, at least 2
+   *  twiddle_factors (float *)
+   *    The array of twiddle factors
+   *  tw_stride (int)
+   *    The number of elements to skip between two successive twiddle factors of a size n transform
+   *  bitrev, pairs
+   *    The permutation from fft_bitrev_init(bitrev, n)
+   */
+  int p, m, j, k;
+  float t;
+
+  for (p = 0 ; p < pairs ; p++)
+  {
+    int a = 2 * bitrev[2 * p];
+    int b = 2 * bitrev[2 * p + 1];
+    t = x[a];     x[a] = x[b];         x[b] = t;
+    t = x[a + 1]; x[a + 1] = x[b + 1]; x[b + 1] = t;
+  }
+
+  // Size 2 transforms have no twiddle multiplications
+  for (j = 0 ; j < 2 * n ; j += 4)
+  {
+    float ar = x[j], ai = x[j + 1];
+    x[j]     = ar + x[j + 2];
+    x[j + 1] = ai + x[j + 3];
+    x[j + 2] = ar - x[j + 2];
+    x[j + 3] = ai - x[j + 3];
+  }
+
+  // Stage of size m, butterfly k of every block shares its twiddle factor.
+  // The second half of a block starts m / 2 complex samples, m floats, in.
+  for (m = 4 ; m <= n ; m *= 2)
+  {
+    int step = tw_stride * (n / m);
+    for (k = 0 ; k < m / 2 ; k++)
+    {
+      float c = twiddle_factors[k * step];
+      float s = twiddle_factors[k * step + 1];
+      for (j = 2 * k ; j < 2 * n ; j += 2 * m)
+      {
+        float *a = x + j;
+        float *b = x + j + m;
+        float br =  c * b[0] + s * b[1];
+        float bi = -s * b[0] + c * b[1];
+        b[0] = a[0] - br;
+        b[1] = a[1] - bi;
+        a[0] += br;
+        a[1] += bi;
+      }
+    }
+  }
+}
+
+inline void rfft_inplace(float *x, float *twiddle_factors, int n, const unsigned short *bitrev, int pairs)
+{
+  /*
+   * Real FFT written over its input, same output layout as rfft.
+   *
+   * Parameters
+   * ----------
+   *  x (float *)
+   *    The n real samples, replaced by the transform
+   *  twiddle_factors (float *)
+   *    The twiddle factors of a size n FFT, as set up by fft_init
+   *  n (int)
+   *    The FFT size, a power of 2, at least 4
+   *  bitrev, pairs
+   *    The permutation from fft_bitrev_init(bitrev, n / 2)
+   */
+  fft_inplace(x, n / 2, twiddle_factors, 4, bitrev, pairs);
+
+  float t = x[0];
+  x[0] = t + x[1];  // DC coefficient
+  x[1] = t - x[1];  // Center coefficient
+
+  // Apply post processing to quarter element
+  x[n/2+1] = -x[n/2+1];
+
+  rfft_pruned_post(x, twiddle_factors, n, 1, n / 4 - 1);
+}
+
+inline int rfft_pruned_mask_size(int n)
+{
+  /*
+   * Number of bytes of mask memory needed by rfft_pruned_init for a real FFT of size n.
+   * One byte per output of every sub-transform size n/2, n/4, ..., 1.
+   */
+  return n;
+}
+
+inline fft_pruned_plan_t *rfft_pruned_init(fft_pruned_plan_t *plan, unsigned char *masks, float *twiddle_factors, int n, int bin_start, int bin_end)
+{
+  /*
+   * Plan a real FFT that only computes output bins bin_start to bin_end.
+   *
+   * The real FFT of size n is done with a complex FFT of size N = n / 2.
+   * Real bin k is built from complex bins k and N - k, so these are marked
+   * as needed in the mask of size N. Output j of a sub-transform of size m
+   * feeds outputs j, j + m, ... of the transform of size 2m, so the mask of
+   * every smaller size is the previous one folded in half. The butterflies
+   * of split_radix_fft_pruned are skipped when none of their outputs is needed.
+   *
+   * Parameters
+   * ----------
+   *  plan (fft_pruned_plan_t *)
+   *    The plan to fill in
+   *  masks (unsigned char *)
+   *    Memory for the masks, rfft_pruned_mask_size(n) bytes
+   *  twiddle_factors (float *)
+   *    The twiddle factors of a size n FFT, as set up by fft_init
+   *  n (int)
+   *    The FFT size, should be a power of 2
+   *  bin_start, bin_end (int)
+   *    Range of output bins to compute, 0 <= bin_start <= bin_end <= n / 2
+   */
+  int N = n / 2;
+  int m, j, k;
+
+  if ((n & (n-1)) != 0 || n < 4 || bin_start < 0 || bin_end > N || bin_start > bin_end)
+    return NULL;
+
+  plan->size = n;
+  plan->bin_start = bin_start;
+  plan->bin_end = bin_end;
+  plan->masks = masks;
+  plan->twiddle_factors = twiddle_factors;
+
+  // Mask of the top level complex transform
+  for (j = 0 ; j < N ; j++)
+    masks[j] = 0;
+  for (k = bin_start ; k <= bin_end ; k++)
+  {
+    masks[k % N] = 1;
+    masks[(N - k) % N] = 1;
+  }
+
+  // Fold down to every smaller size, the mask of size m starts at 2N - 2m.
+  // A size where fewer than 1/8 of the butterflies could be skipped is
+  // treated as fully needed, checking the mask would cost more than it saves.
+  plan->full_size = 0;
+  unsigned char *mask = masks;
+  for (m = N ; m >= 1 ; m /= 2)
+  {
+    int needed = 0;
+    for (j = 0 ; j < m / 4 ; j++)
+      needed += mask[j] | mask[j + m / 4] | mask[j + m / 2] | mask[j + 3 * m / 4];
+    if (8 * needed >= 7 * (m / 4) && plan->full_size == 0)
+      plan->full_size = m;
+
+    if (m > 1)
+      for (j = 0 ; j < m / 2 ; j++)
+        mask[m + j] = mask[j] | mask[j + m / 2];
+    mask += m;
+  }
+
+  return plan;
+}
+
+inline void rfft_pruned_post(float *y, float *twiddle_factors, int n, int b_start, int b_end)
+{
+  /*
+   * The post processing loop of rfft, only for the bin pairs (b, n/2 - b)
+   * with b_start <= b <= b_end.
+   */
+  int k;
+  for (k = 2 * b_start ; k <= 2 * b_end ; k += 2)
+  {
+    float xer, xei, x0r, xoi, c, s, tr, ti;
+
+    c = twiddle_factors[k];
+    s = twiddle_factors[k+1];
+    
+    // even half coefficient
+    xer = 0.5 * (y[k] + y[n-k]);
+    xei = 0.5 * (y[k+1] - y[n-k+1]);
+
+    // odd half coefficient
+    x0r = 0.5 * (y[k+1] + y[n-k+1]);
+    xoi = - 0.5 * (y[k] - y[n-k]);
+
+    tr =  c * x0r + s * xoi;
+    ti = -s * x0r + c * xoi;
+
+    y[k]   = xer + tr;
+    y[k+1] = xei + ti;
+
+    y[n-k]   =   xer - tr;
+    y[n-k+1] = -(xei - ti);
+  }
+}
+
+inline void rfft_pruned(float *x, float *y, const fft_pruned_plan_t *plan)
+{
+  /*
+   * Real FFT that only computes the output bins of the plan.
+   *
+   * Same input and output layout as rfft. The content of the bins outside
+   * plan->bin_start to plan->bin_end is undefined. y[0] (DC) and y[1]
+   * (center) are only valid if bin 0 and bin n / 2 are in the range.
+   */
+  int n = plan->size;
+  int N = n / 2;
+  float *twiddle_factors = plan->twiddle_factors;
+
+  split_radix_fft_pruned(x, y, N, 2, twiddle_factors, 4, plan);
+
+  float t = y[0];
+  y[0] = t + y[1];  // DC coefficient
+  y[1] = t - y[1];  // Center coefficient
+
+  // Apply post processing to quarter element
+  y[n/2+1] = -y[n/2+1];
+
+  // Bin b and N - b are computed together, run the loop for every b < N / 2
+  // that has itself or its partner in the range
+  int lo1 = plan->bin_start, hi1 = plan->bin_end;
+  int lo2 = N - plan->bin_end, hi2 = N - plan->bin_start;
+  if (lo1 < 1) lo1 = 1;
+  if (lo2 < 1) lo2 = 1;
+  if (hi1 > N / 2 - 1) hi1 = N / 2 - 1;
+  if (hi2 > N / 2 - 1) hi2 = N / 2 - 1;
+
+  if (lo2 <= hi1 + 1 && lo1 <= hi2 + 1)
+  {
+    // Overlapping ranges, one loop
+    rfft_pruned_post(y, twiddle_factors, n, lo1 < lo2 ? lo1 : lo2, hi1 > hi2 ? hi1 : hi2);
+  }
+  else
+  {
+    rfft_pruned_post(y, twiddle_factors, n, lo1, hi1);
+    rfft_pruned_post(y, twiddle_factors, n, lo2, hi2);
+  }
+}
+
+inline void split_radix_fft_pruned(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride, const fft_pruned_plan_t *plan)
+{
+  /*
+   * Split-radix FFT that skips the butterflies whose outputs are not needed.
+   *
+   * Same parameters as split_radix_fft, plus the plan holding the masks.
+   * Only the final butterflies of every level can be skipped, the
+   * sub-transforms always need all their inputs.
+   */
+  int k;
+
+  // Small or fully needed transforms are not worth checking
+  if (n <= 8 || n <= plan->full_size)
+  {
+    SPLIT_RADIX_KERNEL(x, y, n, stride, twiddle_factors, tw_stride);
+    return;
+  }
+
+  const unsigned char *need = plan->masks + plan->size - 2 * n;
+
+  split_radix_fft_pruned(x, y, n / 2, 2 * stride, twiddle_factors, 2 * tw_stride, plan);
+  split_radix_fft_pruned(x + stride, y + n, n / 4, 4 * stride, twiddle_factors, 4 * tw_stride, plan);
+  split_radix_fft_pruned(x + 3 * stride, y + n + n / 2, n / 4, 4 * stride, twiddle_factors, 4 * tw_stride, plan);
+
+  // Stitch together the outputs, k = 0 has no twiddle multiplications
+  float u1r, u1i, u2r, u2i, x1r, x1i, x2r, x2i;
+  float t;
+
+  if (need[0] | need[n / 4] | need[n / 2] | need[3 * n / 4])
+  {
+    u1r = y[0];
+    u1i = y[1];
+    u2r = y[n / 2];
+    u2i = y[n / 2 + 1];
+
+    x1r = y[n];
+    x1i = y[n + 1];
+    x2r = y[n / 2 + n];
+    x2i = y[n / 2 + n + 1];
+
+    t = x1r + x2r;
+    y[0] = u1r + t;
+    y[n]     = u1r - t;
+
+    t = x1i + x2i;
+    y[1] = u1i + t;
+    y[n + 1] = u1i - t;
+
+    t = x2i - x1i;
+    y[n / 2]     = u2r - t;
+    y[n + n / 2]     = u2r + t;
+
+    t = x1r - x2r;
+    y[n / 2 + 1] = u2i - t;
+    y[n + n / 2 + 1] = u2i + t;
+  }
 
   for (k = 1 ; k < n / 4 ; k++)
   {
+    // Outputs k, k + n/4, k + n/2 and k + 3n/4 come out of this butterfly
+    if (!(need[k] | need[k + n / 4] | need[k + n / 2] | need[k + 3 * n / 4]))
+      continue;
+
     float u1r, u1i, u2r, u2i, x1r, x1i, x2r, x2i, c1, s1, c2, s2;
     c1 = twiddle_factors[k * tw_stride];
     s1 = twiddle_factors[k * tw_stride + 1];
@@ -536,7 +1156,6 @@ inline void split_radix_fft(float *x, float *y, int n, int stride, float *twiddl
     y[2 * k + n / 2 + 1] = u2i - t;
     y[2 * k + n + n / 2 + 1] = u2i + t;
   }
-
 }
 
 
@@ -544,7 +1163,7 @@ inline void ifft_primitive(float *input, float *output, int n, int stride, float
 {
 
 #if USE_SPLIT_RADIX
-  split_radix_fft(input, output, n, stride, twiddle_factors, tw_stride);
+  SPLIT_RADIX_KERNEL(input, output, n, stride, twiddle_factors, tw_stride);
 #else
   fft_primitive(input, output, n, stride, twiddle_factors, tw_stride);
 #endif
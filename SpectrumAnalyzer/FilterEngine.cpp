@@ -0,0 +1,190 @@
+/*
+*   FilterEngine.cpp
+*   Created on: Oct 19, 2026
+*   Overlap-save FIR filter and the designs for it.
+*/
+#include "FilterEngine.h"
+#include "FFT.h"
+#include <string.h>
+
+//Functions
+
+/*
+*   Function to get the Hamming window.
+*   Input: int n - Tap number.
+*   Input: int Count - Number of taps.
+*   Output: float - The window at the tap.
+*/
+static float Hamming(int n, int Count){
+  return (Count > 1)? 0.54 - 0.46 * cosf(TWO_PI * n / (Count - 1)) : 1.0;
+}
+
+/*
+*   Function to get sin(pi x)/(pi x), with its limit of 1 at 0.
+*   Input: float x - The point.
+*   Output: float - sinc(x).
+*/
+static float Sinc(float x){
+  return (fabsf(x) < 1e-6)? 1.0 : sinf(M_PI * x) / (M_PI * x);
+}
+
+/*
+*   Function to set up the filter engine and work out the spectrum of the filter.
+*   Input: FilterEngine *E - The engine to fill in.
+*   Input: float *Buffer - Memory for FILTER_BUFFER_FLOATS floats.
+*   Input: const float *Taps - The impulse response of the filter.
+*   Input: int Count - Number of taps, at most FILTER_MAX_TAPS. Longer filters are cut.
+*   Output: FilterEngine * - The engine.
+*/
+FilterEngine *InitializeFilterEngine(FilterEngine *E, float *Buffer, const float *Taps, int Count){
+  memset(Buffer, 0, FILTER_BUFFER_FLOATS * sizeof(float));
+  E->Twiddles = Buffer;
+  E->Response = E->Twiddles + 2 * FILTER_FFT_SIZE;
+  E->Work = E->Response + FILTER_FFT_SIZE;
+  E->Output = E->Work + FILTER_FFT_SIZE;
+  E->Overlap = E->Output + FILTER_FFT_SIZE;
+  E->Taps = (Count > FILTER_MAX_TAPS)? FILTER_MAX_TAPS : Count;
+  fft_config_t Config;
+  fft_init_static(&Config, E->Twiddles, FILTER_FFT_SIZE, FFT_REAL, FFT_FORWARD, E->Work, E->Output);
+
+  //The filter padded with zeros to the FFT size, its spectrum is what every block is multiplied with.
+  memcpy(E->Work, Taps, E->Taps * sizeof(float));
+  rfft(E->Work, E->Response, E->Twiddles, FILTER_FFT_SIZE);
+  memset(E->Work, 0, FILTER_FFT_SIZE * sizeof(float));
+  return E;
+}
+
+/*
+*   Function to filter the sampled data, block by block.
+*   Every block is put behind the FILTER_FFT_SIZE - FILTER_BLOCK samples before it, that is transformed,
+*   multiplied with the spectrum of the filter and transformed back. The circular wrap only spoils the
+*   first Taps - 1 outputs, which are the overlap, so the last FILTER_BLOCK are the filtered block.
+*   The overlap is kept between calls, so frames are filtered as one continuous signal.
+*   Input: FilterEngine *E - The engine.
+*   Input: const float *Input - The samples.
+*   Input: float *Output - Set to the filtered samples, can be the same as Input.
+*   Input: int Count - Number of samples, a multiple of FILTER_BLOCK.
+*   Input: float Offset - Taken off before filtering and added back after, so the filter does not see the ADC mid scale.
+*   Output: None.
+*/
+void RunFilterEngine(FilterEngine *E, const float *Input, float *Output, int Count, float Offset){
+  const int Keep = FILTER_FFT_SIZE - FILTER_BLOCK;
+  for(int b = 0; b + FILTER_BLOCK <= Count; b += FILTER_BLOCK){
+    //1. Overlap followed by the new block, and the overlap of the next block.
+    memcpy(E->Work, E->Overlap, Keep * sizeof(float));
+    for(int i = 0; i < FILTER_BLOCK; i++){
+      E->Work[Keep + i] = Input[b + i] - Offset;
+    }
+    memcpy(E->Overlap, E->Work + FILTER_BLOCK, Keep * sizeof(float));
+
+    //2. Multiply the spectra. DC and centre are real, the other bins are real/imaginary pairs.
+    rfft(E->Work, E->Output, E->Twiddles, FILTER_FFT_SIZE);
+    float *X = E->Output;
+    const float *H = E->Response;
+    X[0] *= H[0];
+    X[1] *= H[1];
+    for(int k = 2; k < FILTER_FFT_SIZE; k += 2){
+      float Re = X[k] * H[k] - X[k+1] * H[k+1];
+      float Im = X[k] * H[k+1] + X[k+1] * H[k];
+      X[k] = Re;
+      X[k+1] = Im;
+    }
+
+    //3. Back to samples, only the end of the block is valid.
+    irfft(E->Output, E->Work, E->Twiddles, FILTER_FFT_SIZE);
+    for(int i = 0; i < FILTER_BLOCK; i++){
+      Output[b + i] = E->Work[Keep + i] + Offset;
+    }
+  }
+}
+
+/*
+*   Function to design a band pass or band stop(notch) filter, a windowed sinc.
+*   Input: float *Taps - Set to the impulse response.
+*   Input: int Count - Number of taps, odd so the band stop has a centre tap.
+*   Input: float FreqLow, FreqHigh - Edges of the band(Hz). 0 for FreqLow makes it a low pass.
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Input: bool Stop - True for a band stop.
+*   Output: None.
+*/
+void DesignBandFilter(float *Taps, int Count, float FreqLow, float FreqHigh, float SampleRate, bool Stop){
+  float Low = FreqLow / SampleRate;               //Cycles per sample
+  float High = FreqHigh / SampleRate;
+  float Centre = (Count - 1) / 2.0;
+  for(int n = 0; n < Count; n++){
+    float t = n - Centre;
+    float BandPass = 2 * High * Sinc(2 * High * t) - 2 * Low * Sinc(2 * Low * t);
+    float Impulse = (fabsf(t) < 1e-6)? 1.0 : 0.0;
+    Taps[n] = (Stop? Impulse - BandPass : BandPass) * Hamming(n, Count);
+  }
+}
+
+/*
+*   Function to design an equalizer, by sampling the wanted response at the bins of a Count point DFT.
+*   Between two bands the gain(dB) is interpolated on a log frequency scale, outside them it stays flat.
+*   Input: float *Taps - Set to the impulse response.
+*   Input: int Count - Number of taps, odd.
+*   Input: const float *BandFreqs - Centre of every band(Hz), rising.
+*   Input: const float *BandGainsDb - Gain of every band(dB).
+*   Input: int Bands - Number of bands.
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Output: None.
+*/
+void DesignEqualizer(float *Taps, int Count, const float *BandFreqs, const float *BandGainsDb, int Bands, float SampleRate){
+  float Centre = (Count - 1) / 2.0;
+  for(int n = 0; n < Count; n++){
+    Taps[n] = 0;
+  }
+  for(int k = 0; k <= (Count - 1) / 2; k++){
+    float Freq = k * SampleRate / Count;
+    float GainDb;
+    if(Freq < BandFreqs[0]){
+      GainDb = BandGainsDb[0];                    //DC and below the first band
+    }
+    else if(Freq >= BandFreqs[Bands - 1]){
+      GainDb = BandGainsDb[Bands - 1];
+    }
+    else{
+      int b = 0;
+      while(Freq >= BandFreqs[b + 1]){            //BandFreqs[b] <= Freq < BandFreqs[b + 1], a bin on a band centre gets its gain
+        b++;
+      }
+      float Share = logf(Freq / BandFreqs[b]) / logf(BandFreqs[b + 1] / BandFreqs[b]);
+      GainDb = BandGainsDb[b] + Share * (BandGainsDb[b + 1] - BandGainsDb[b]);
+    }
+    float Gain = powf(10, GainDb / 20);
+    //A real, linear phase response: every bin but DC appears twice, as k and -k.
+    for(int n = 0; n < Count; n++){
+      Taps[n] += ((k == 0)? 1 : 2) * Gain * cosf(TWO_PI * k * (n - Centre) / Count) / Count;
+    }
+  }
+  for(int n = 0; n < Count; n++){
+    Taps[n] *= Hamming(n, Count);
+  }
+}
+
+/*
+*   Function to filter the slow way, one multiply per tap per sample. Used to check the engine.
+*   Input: const float *Input - The samples.
+*   Input: int Count - Number of samples.
+*   Input: const float *Taps - The impulse response.
+*   Input: int TapCount - Number of taps.
+*   Input: const float *History - TapCount - 1 samples before the input, oldest first. NULL for zeros.
+*   Input: float *Output - Set to the filtered samples.
+*   Output: None.
+*/
+void DirectConvolution(const float *Input, int Count, const float *Taps, int TapCount, const float *History, float *Output){
+  for(int i = 0; i < Count; i++){
+    float Sum = 0;
+    for(int k = 0; k < TapCount; k++){
+      int Index = i - k;
+      if(Index >= 0){
+        Sum += Taps[k] * Input[Index];
+      }
+      else if(History != NULL){
+        Sum += Taps[k] * History[TapCount - 1 + Index];
+      }
+    }
+    Output[i] = Sum;
+  }
+}
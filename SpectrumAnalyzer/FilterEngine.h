@@ -0,0 +1,43 @@
+/*
+    * FilterEngine.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the FIR filter that can be applied to the sampled
+    *  data. It uses overlap-save fast convolution on top of rfft/irfft, with the
+    *  spectrum of the filter worked out once, so a long filter costs a few
+    *  operations per sample per FFT stage instead of one per tap.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _FILTERENGINE_H
+#define _FILTERENGINE_H
+
+//Defines
+#define FILTER_FFT_SIZE 512                     //Size of the FFT every block is filtered with
+#define FILTER_BLOCK 256                        //New samples per FFT, the rest of the FFT is the overlap with the samples before
+#define FILTER_MAX_TAPS (FILTER_FFT_SIZE - FILTER_BLOCK + 1)
+#define FILTER_BUFFER_FLOATS (6 * FILTER_FFT_SIZE - FILTER_BLOCK)   //Size of the buffer handed to InitializeFilterEngine()
+
+//Which filter FILTER_KIND selects: DesignBandFilter() makes the band pass and the notch, DesignEqualizer() the equalizer
+enum FilterType{
+  FILTER_BANDPASS,                              //Passes FreqLow to FreqHigh, 0 for FreqLow makes it a low pass
+  FILTER_NOTCH,                                 //Stops FreqLow to FreqHigh
+  FILTER_EQUALIZER                              //Follows the gains of the equalizer bands
+};
+
+struct FilterEngine{
+  float *Twiddles;                              //Twiddle factors of a FILTER_FFT_SIZE FFT
+  float *Response;                              //Spectrum of the filter, rfft layout
+  float *Work;                                  //FFT input, the overlap followed by the new block
+  float *Output;                                //FFT output
+  float *Overlap;                               //Last FILTER_FFT_SIZE - FILTER_BLOCK input samples
+  int Taps;
+};
+
+//Function Prototypes
+FilterEngine *InitializeFilterEngine(FilterEngine *E, float *Buffer, const float *Taps, int Count);
+void  RunFilterEngine(FilterEngine *E, const float *Input, float *Output, int Count, float Offset);
+void  DesignBandFilter(float *Taps, int Count, float FreqLow, float FreqHigh, float SampleRate, bool Stop);
+void  DesignEqualizer(float *Taps, int Count, const float *BandFreqs, const float *BandGainsDb, int Bands, float SampleRate);
+void  DirectConvolution(const float *Input, int Count, const float *Taps, int TapCount, const float *History, float *Output);
+#endif //_FILTERENGINE_H
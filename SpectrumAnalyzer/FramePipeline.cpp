@@ -0,0 +1,87 @@
+/*
+*   FramePipeline.cpp
+*   Created on: Oct 19, 2026
+*   Holds the statically allocated frame pool and the bookkeeping of the three stage pipeline.
+*/
+#include "FramePipeline.h"
+#include "MemoryArena.h"
+
+//Define the global variables
+Frame *FramePool = NULL;
+FrameQueue FreeQueue;
+FrameQueue ComputeQueue;
+FrameQueue RenderQueue;
+StageStats AcquireStats;
+StageStats ComputeStats;
+StageStats RenderStats;
+
+//Functions
+
+/*
+*   Function to carve the frame pool out of the arena and hand every frame to the acquire stage.
+*   Must be called before the tasks are started.
+*   Input: None.
+*   Output: None.
+*/
+void InitializeFramePool(){
+  FramePool = (Frame *)ArenaAlloc(ARENA_BUDGET_FRAMES, "Frame pool", ARENA_OTHER);
+  float *Samples = (float *)ArenaAlloc(ARENA_BUDGET_SAMPLES, "Frame samples", ARENA_SAMPLES);
+  //The spectrum is only used inside the processing task, which works on one frame at a time, so the frames share it.
+  float *Spectra = (float *)ArenaAlloc(ARENA_BUDGET_SPECTRA, "Spectra", ARENA_SPECTRA);
+  uint32_t *Display = (uint32_t *)ArenaAlloc(ARENA_BUDGET_DISPLAY, "Frame display", ARENA_DISPLAY);
+  for(int i = 0; i < FRAME_POOL_SIZE; i++){
+    FramePool[i].Samples = &Samples[i * BUFFER_SIZE];
+    FramePool[i].Spectrum = Spectra;
+    FramePool[i].DisplayData = &Display[i * FFTPLOT_CHANNEL];
+    FramePool[i].SamplesAux = DUAL_CHANNEL? &Samples[(FRAME_POOL_SIZE + i) * BUFFER_SIZE] : NULL;
+    FramePool[i].SpectrumAux = DUAL_CHANNEL? &Spectra[BUFFER_SIZE] : NULL;
+    FramePool[i].HasSpectrum = false;
+    FramePool[i].Redundant = false;
+    FramePool[i].Sequence = 0;
+    FreeQueue.Push(&FramePool[i]);
+  }
+}
+
+/*
+*   Function to update the counters of a stage after it handled a frame.
+*   Input: StageStats &Stats - The counters of the stage.
+*   Input: uint8_t QueueDepth - Frames that were waiting at the input of the stage.
+*   Input: unsigned long BusyUs - Time the stage spent on the frame.
+*   Output: None.
+*/
+void UpdateStageStats(StageStats &Stats, uint8_t QueueDepth, unsigned long BusyUs){
+  Stats.Frames++;
+  Stats.BusyUs += BusyUs;
+  Stats.QueueDepthSum += QueueDepth;
+  if(QueueDepth > Stats.QueueDepthMax){
+    Stats.QueueDepthMax = QueueDepth;
+  }
+}
+
+/*
+*   Function to print the per stage counters of the last interval to the Serial object.
+*   The counters are never reset, the interval values are the difference to the last call,
+*   so the stages stay the only writers of their counters.
+*   Occupancy is the share of the interval the stage spent working.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Output: None.
+*/
+void PrintPipelineStats(Stream &Serial){
+  static unsigned long IntervalStart = 0;
+  static StageStats Last[3];
+  unsigned long timeNow = micros();
+  float Interval = (timeNow - IntervalStart) / 100.0;  //In units of 1% of the interval.
+  IntervalStart = timeNow;
+
+  StageStats *Stats[3] = {&AcquireStats, &ComputeStats, &RenderStats};
+  const char *Names[3] = {"Acquire", "Compute", "Render"};
+  Serial.println("----Pipeline Stats----");
+  for(int i = 0; i < 3; i++){
+    StageStats Now = *Stats[i];
+    unsigned long Frames = Now.Frames - Last[i].Frames;
+    float AvgDepth = (Frames > 0)? (Now.QueueDepthSum - Last[i].QueueDepthSum) * 1.0 / Frames : 0.0;
+    Serial.printf("%s: frames %lu, drops %lu, occupancy %.1f%%, queue avg %.2f max %d\n",
+                  Names[i], Frames, Now.Drops - Last[i].Drops, (Now.BusyUs - Last[i].BusyUs) / Interval, AvgDepth, Now.QueueDepthMax);
+    Last[i] = Now;
+  }
+}
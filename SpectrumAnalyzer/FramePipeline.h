@@ -0,0 +1,77 @@
+/*
+    * FramePipeline.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the frame pool and the queues used to hand frames
+    *  between the acquire, compute and render stages, so that each stage can
+    *  work on a different frame at the same time.
+    *  
+*/
+#ifndef _FRAMEPIPELINE_H
+#define _FRAMEPIPELINE_H
+
+#include <Arduino.h>
+#include "SignalSampler.h"
+#include "DisplayFunctions.h"
+#include "PartialTracker.h"
+#include "SpectrumPipeline.h"
+#include "FrameQueue.h"
+
+//Defines
+//FRAME_POOL_SIZE, the frames in flight, is in FrameQueue.h
+#define PIPELINE_STATS_INTERVAL 100                     //Rendered frames between two pipeline stat reports
+
+//Everything that travels down the pipeline for one capture.
+//The buffers are carved from the arena by InitializeFramePool().
+struct Frame{
+  float *Samples;                                       //Sampled data (BUFFER_SIZE), also the FFT input
+  float *Spectrum;                                      //FFT output (BUFFER_SIZE), holds the magnitudes after InputSpectrum::Magnitudes() and garbage after DetectPitch(). Shared by every frame, only valid in the processing task
+  float *SamplesAux;                                    //Sampled data of the AUX input, NULL unless DUAL_CHANNEL
+  float *SpectrumAux;                                   //FFT output of the AUX input, NULL unless DUAL_CHANNEL. Shared like Spectrum
+  uint32_t *DisplayData;                                //Bar heights for the FFT plot (FFTPLOT_CHANNEL), split between the inputs with DUAL_CHANNEL
+  double SignalAverage;                                 //Average of the sampled data
+  float MajorFreq;                                      //Frequency with the maximum magnitude, from the phase of the strongest partial if there is one
+  float MajorFreqAux;                                   //Same for the AUX input
+  bool HasSpectrum;                                     //False if the FFT was skipped (waveform plot)
+  int TriggerIndex;                                     //First sample of the waveform plot, from the trigger
+  bool Redundant;                                       //The power governor found nothing new to draw, the render stage skips the frame
+  uint8_t Mode;                                         //PlotMode the frame was processed for
+  int Channels;                                         //Bars in DisplayData
+  bool Beat;                                            //The beat detector found a beat in this frame
+  float Bpm;                                            //Tempo of the beats so far, 0 if not known yet
+  float Pitch;                                          //Fundamental from the pitch detector, 0 if there is none
+  Partial Partials[PARTIAL_COUNT];                      //Strongest tonal components of the main input, strongest first
+  uint8_t PartialCount;
+  uint8_t Markers[PARTIAL_COUNT];                       //Bars of the FFT plot the partials fall in, marked by PlotFFTBarGraph()
+  uint8_t MarkerCount;
+  unsigned long Sequence;                               //Capture number, used to spot dropped frames
+  unsigned long CaptureUs;                              //micros() when the DMA completed the capture, the latency is measured from here
+  unsigned long ImpulseUs;                              //Latency test: micros() of the injected impulse, 0 if the capture has none
+};
+
+//Counters kept by each stage. Only the owning stage writes them.
+struct StageStats{
+  unsigned long Frames;                                 //Frames handled by the stage
+  unsigned long Drops;                                  //Frames the stage had to throw away
+  unsigned long BusyUs;                                 //Time spent working (not waiting)
+  unsigned long QueueDepthSum;                          //Sum of the input queue depth seen at every frame
+  uint8_t QueueDepthMax;                                //Deepest the input queue has been
+};
+
+//The queues between the stages
+typedef SPSCQueue<FRAME_POOL_SIZE, Frame> FrameQueue;
+
+//Global Variables
+extern  Frame *FramePool;                               //FRAME_POOL_SIZE frames
+extern  FrameQueue FreeQueue;                           //render  -> acquire, empty frames
+extern  FrameQueue ComputeQueue;                        //acquire -> compute, freshly sampled frames
+extern  FrameQueue RenderQueue;                         //compute -> render, frames ready to be drawn
+extern  StageStats AcquireStats;
+extern  StageStats ComputeStats;
+extern  StageStats RenderStats;
+
+//Function Prototypes
+void    InitializeFramePool();
+void    UpdateStageStats(StageStats &Stats, uint8_t QueueDepth, unsigned long BusyUs);
+void    PrintPipelineStats(Stream &Serial);
+#endif //_FRAMEPIPELINE_H
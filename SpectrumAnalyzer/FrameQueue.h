@@ -0,0 +1,61 @@
+/*
+    * FrameQueue.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the queue the stages of the pipeline hand their
+    *  frames through. The sketch runs it between its tasks (FramePipeline.h),
+    *  the pipeline benchmark runs the same queue between its stages, with
+    *  as many frames.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _FRAMEQUEUE_H
+#define _FRAMEQUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "SampleStages.h"
+
+//Defines
+#define FRAME_POOL_SIZE (DUAL_CHANNEL? 3 : 4)           //Frames in flight, one per stage plus a spare if memory allows
+
+//Lock free single producer / single consumer queue of pointers to Item.
+//One slot is kept empty to tell a full queue from an empty one.
+template <int Size, class Item>
+class SPSCQueue {
+  private:
+    Item *Items[Size + 1];
+    std::atomic<uint8_t> Head;                          //Next slot to read, only written by the consumer
+    std::atomic<uint8_t> Tail;                          //Next slot to write, only written by the producer
+
+  public:
+    SPSCQueue() : Head(0), Tail(0) {}
+
+    bool Push(Item *Entry){                             //Producer side. False if the queue is full.
+      uint8_t tail = Tail.load(std::memory_order_relaxed);
+      uint8_t next = (tail + 1) % (Size + 1);
+      if(next == Head.load(std::memory_order_acquire)){
+        return false;
+      }
+      Items[tail] = Entry;
+      Tail.store(next, std::memory_order_release);
+      return true;
+    }
+
+    bool Pop(Item *&Entry){                             //Consumer side. False if the queue is empty.
+      uint8_t head = Head.load(std::memory_order_relaxed);
+      if(head == Tail.load(std::memory_order_acquire)){
+        return false;
+      }
+      Entry = Items[head];
+      Head.store((head + 1) % (Size + 1), std::memory_order_release);
+      return true;
+    }
+
+    uint8_t Count(){                                    //Frames waiting, safe to call from either side.
+      uint8_t head = Head.load(std::memory_order_acquire);
+      uint8_t tail = Tail.load(std::memory_order_acquire);
+      return (tail + Size + 1 - head) % (Size + 1);
+    }
+};
+#endif //_FRAMEQUEUE_H
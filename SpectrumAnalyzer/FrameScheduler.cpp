@@ -0,0 +1,176 @@
+/*
+*   FrameScheduler.cpp
+*   Created on: Oct 19, 2026
+*   Deadline based pacing of the visualization task and its frame time statistics.
+*/
+#include "FrameScheduler.h"
+#include <math.h>
+
+//Functions
+
+/*
+*   Function to set up the scheduler, the first deadline is right away.
+*   The period is never shorter than the time between two new frames from the source. Deadlines
+*   faster than that would find no frame at nearly every one, and each frame would start a new grid.
+*   Input: FrameScheduler *S - The scheduler.
+*   Input: float TargetFPS - Frames per second to aim for.
+*   Input: unsigned long SourcePeriodUs - Time between two new frames from the source(us).
+*   Input: unsigned long Now - Current time(us).
+*   Output: None.
+*/
+void InitializeFrameScheduler(FrameScheduler *S, float TargetFPS, unsigned long SourcePeriodUs, unsigned long Now){
+  S->PeriodUs = 1000000.0 / TargetFPS;
+  S->PeriodUs = (S->PeriodUs < SourcePeriodUs)? SourcePeriodUs : S->PeriodUs;
+  S->NextDeadline = Now;
+  S->LastStart = Now;
+  S->Resync = true;
+  S->Frames = 0;
+  S->Missed = 0;
+  S->Skipped = 0;
+  S->Starved = 0;
+  for(int i = 0; i < FRAME_HIST_BINS; i++){
+    S->Histogram[i] = 0;
+  }
+  S->JitterSum = 0;
+  S->JitterSqSum = 0;
+  S->JitterMax = 0;
+  S->JitterFrames = 0;
+  S->FrameRate = 0;
+  S->WindowBusyUs = 0;
+  S->WindowMissed = 0;
+  S->WindowFrames = 0;
+  S->Quality = FRAME_QUALITY_FULL;
+}
+
+/*
+*   Function to get the time left until the next frame is due.
+*   Input: const FrameScheduler *S - The scheduler.
+*   Input: unsigned long Now - Current time(us).
+*   Output: long - Microseconds until the deadline, 0 or less if it has passed.
+*/
+long FrameTimeToDeadline(const FrameScheduler *S, unsigned long Now){
+  return (long)(S->NextDeadline - Now);
+}
+
+/*
+*   Function to record the start of a frame and set the next deadline.
+*   The next deadline is one period after this one, not after Now, so a late frame does not
+*   push back the ones after it and the frame rate does not drift. If rendering overran by whole
+*   periods, those deadlines are skipped instead of rendering a burst of frames to catch up.
+*   Input: FrameScheduler *S - The scheduler.
+*   Input: unsigned long Now - Current time(us).
+*   Output: None.
+*/
+void FrameStarted(FrameScheduler *S, unsigned long Now){
+  if(S->Frames > 0){
+    unsigned long Interval = Now - S->LastStart;
+    unsigned long Bin = Interval / FRAME_HIST_BIN_US;
+    S->Histogram[(Bin < FRAME_HIST_BINS)? Bin : FRAME_HIST_BINS - 1]++;
+    float Rate = 1000000.0 / (Interval > 0? Interval : 1);
+    S->FrameRate = (S->FrameRate == 0)? Rate : S->FrameRate + FRAME_RATE_SMOOTHING * (Rate - S->FrameRate);
+  }
+
+  if(S->Resync){
+    //The frame waited on data, not on the scheduler, so it starts a new grid. The grid goes
+    //a little behind the frame, the next frames come one source period after it give or take
+    //the time the processing task takes, and they should not find their deadline before them.
+    S->NextDeadline = Now + FRAME_RESYNC_DELAY_US;
+    S->Resync = false;
+  }
+  else{
+    long Late = (long)(Now - S->NextDeadline);
+    unsigned long Jitter = (Late < 0)? -Late : Late;
+    S->JitterSum += Jitter;
+    S->JitterSqSum += (double)Jitter * Jitter;
+    S->JitterMax = (Jitter > S->JitterMax)? Jitter : S->JitterMax;
+    S->JitterFrames++;
+    if(Late > FRAME_DEADLINE_SLACK_US){
+      S->Missed++;
+      S->WindowMissed++;
+    }
+    if(Late >= (long)S->PeriodUs){
+      unsigned long Behind = Late / S->PeriodUs;
+      S->Skipped += Behind;
+      S->NextDeadline += Behind * S->PeriodUs;
+    }
+  }
+  S->NextDeadline += S->PeriodUs;
+  S->LastStart = Now;
+  S->Frames++;
+}
+
+/*
+*   Function to record the end of a frame. Every FRAME_LOAD_WINDOW frames the share of the
+*   period spent rendering decides if the detail of the plot goes down or up (with FRAME_DEGRADE).
+*   Input: FrameScheduler *S - The scheduler.
+*   Input: unsigned long Now - Current time(us).
+*   Output: None.
+*/
+void FrameFinished(FrameScheduler *S, unsigned long Now){
+  S->WindowBusyUs += Now - S->LastStart;
+  S->WindowFrames++;
+  if(S->WindowFrames < FRAME_LOAD_WINDOW){
+    return;
+  }
+  float Load = S->WindowBusyUs * 1.0 / (S->WindowFrames * S->PeriodUs);
+  if(FRAME_DEGRADE){
+    if(((Load > FRAME_DEGRADE_LOAD) || (S->WindowMissed > FRAME_LOAD_WINDOW / 4)) && (S->Quality < FRAME_QUALITY_COUNT - 1)){
+      S->Quality++;
+    }
+    else if((Load < FRAME_RESTORE_LOAD) && (S->WindowMissed == 0) && (S->Quality > FRAME_QUALITY_FULL)){
+      S->Quality--;
+    }
+  }
+  S->WindowBusyUs = 0;
+  S->WindowMissed = 0;
+  S->WindowFrames = 0;
+}
+
+/*
+*   Function to record that a deadline came without a new frame to draw.
+*   The frame that ends the wait starts a new grid of deadlines and does not count as missed.
+*   Calling it again before that frame does not count again.
+*   Input: FrameScheduler *S - The scheduler.
+*   Output: None.
+*/
+void FrameStarved(FrameScheduler *S){
+  if(!S->Resync){
+    S->Starved++;
+    S->Resync = true;
+  }
+}
+
+/*
+*   Function to get the RMS distance between the frame starts and their deadlines.
+*   Input: const FrameScheduler *S - The scheduler.
+*   Output: float - The jitter(us).
+*/
+float FrameJitterRms(const FrameScheduler *S){
+  return (S->JitterFrames > 0)? sqrt(S->JitterSqSum / S->JitterFrames) : 0.0;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to print the frame time histogram, the jitter and the deadline counters to the Serial object.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const FrameScheduler *S - The scheduler.
+*   Output: None.
+*/
+void PrintFrameSchedulerStats(Stream &Serial, const FrameScheduler *S){
+  Serial.println("----Frame Scheduler Stats----");
+  Serial.printf("Frames %lu, %.1f fps (target %.1f), quality %d\n", S->Frames, S->FrameRate, 1000000.0 / S->PeriodUs, S->Quality);
+  Serial.printf("Missed %lu, skipped %lu, starved %lu\n", S->Missed, S->Skipped, S->Starved);
+  Serial.printf("Jitter mean %.0f us, rms %.0f us, max %lu us\n", (S->JitterFrames > 0)? S->JitterSum / S->JitterFrames : 0.0, FrameJitterRms(S), S->JitterMax);
+  for(int i = 0; i < FRAME_HIST_BINS; i++){
+    if(S->Histogram[i] == 0){
+      continue;
+    }
+    if(i < FRAME_HIST_BINS - 1){
+      Serial.printf("%3d-%3d ms: %lu\n", i * FRAME_HIST_BIN_US / 1000, (i + 1) * FRAME_HIST_BIN_US / 1000, S->Histogram[i]);
+    }
+    else{
+      Serial.printf("  >%3d ms: %lu\n", i * FRAME_HIST_BIN_US / 1000, S->Histogram[i]);
+    }
+  }
+}
+#endif
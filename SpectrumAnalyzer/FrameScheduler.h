@@ -0,0 +1,71 @@
+/*
+    * FrameScheduler.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the frame scheduler of the visualization task.
+    *  Frames are started on a grid of deadlines FPSdesired apart, or one
+    *  capture apart when the captures come slower than that, the time
+    *  between frames, the jitter and the missed deadlines are recorded, and
+    *  the detail of the plot is lowered when rendering can not keep up.
+    *  The logic gets the time passed in and does not depend on the ESP32.
+    *  
+*/
+#ifndef _FRAMESCHEDULER_H
+#define _FRAMESCHEDULER_H
+
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define FRAME_HIST_BINS 16                      //Bins of the frame time histogram
+#define FRAME_HIST_BIN_US 10000                 //Width of a bin(us), the last bin also holds all longer frames
+#define FRAME_DEADLINE_SLACK_US 2000            //A frame that starts more than this after its deadline has missed it
+#define FRAME_RESYNC_DELAY_US 10000             //A new grid of deadlines starts this long after the frame that ended the wait, so the frames after it are ready by their deadline
+#define FRAME_DEGRADE 1                         //Setting this to 1 lets the scheduler drop detail to hold the frame rate
+#define FRAME_LOAD_WINDOW 24                    //Frames between two quality decisions
+#define FRAME_DEGRADE_LOAD 0.9                  //Share of the frame period spent rendering above which detail is dropped
+#define FRAME_RESTORE_LOAD 0.5                  //Share below which it is brought back
+#define FRAME_RATE_SMOOTHING 0.1                //Weight of the newest frame in the frame rate
+
+//Detail levels of the plot, from full to the cheapest
+enum FrameQuality{
+  FRAME_QUALITY_FULL,
+  FRAME_QUALITY_NO_TEXT,                        //The text under the plot is not drawn
+  FRAME_QUALITY_HALF_CHANNELS,                  //No text and half the bars on the FFT plot
+  FRAME_QUALITY_COUNT
+};
+
+struct FrameScheduler{
+  unsigned long PeriodUs;                       //Time between two deadlines
+  unsigned long NextDeadline;                   //Start time of the next frame
+  unsigned long LastStart;                      //Start time of the last frame
+  bool Resync;                                  //The next frame starts a new grid of deadlines (after a wait for data)
+  unsigned long Frames;
+  unsigned long Missed;                         //Frames that started more than FRAME_DEADLINE_SLACK_US late
+  unsigned long Skipped;                        //Deadlines that passed while an earlier frame was still rendering
+  unsigned long Starved;                        //Deadlines where the processing task had no new frame
+  unsigned long Histogram[FRAME_HIST_BINS];     //Time between the start of two frames
+  double JitterSum;                             //Sum of the distance between frame start and deadline(us)
+  double JitterSqSum;                           //Sum of its square, for the RMS
+  unsigned long JitterMax;
+  unsigned long JitterFrames;                   //Frames the jitter sums are over
+  float FrameRate;                              //Smoothed frames per second
+  unsigned long WindowBusyUs;                   //Render time in the current quality window
+  unsigned long WindowMissed;                   //Missed deadlines in the current quality window
+  unsigned long WindowFrames;
+  uint8_t Quality;                              //The current FrameQuality
+};
+
+//Function Prototypes
+void  InitializeFrameScheduler(FrameScheduler *S, float TargetFPS, unsigned long SourcePeriodUs, unsigned long Now);
+long  FrameTimeToDeadline(const FrameScheduler *S, unsigned long Now);
+void  FrameStarted(FrameScheduler *S, unsigned long Now);
+void  FrameFinished(FrameScheduler *S, unsigned long Now);
+void  FrameStarved(FrameScheduler *S);
+float FrameJitterRms(const FrameScheduler *S);
+#ifdef ARDUINO
+void  PrintFrameSchedulerStats(Stream &Serial, const FrameScheduler *S);
+#endif
+#endif //_FRAMESCHEDULER_H
@@ -0,0 +1,91 @@
+/*
+*   LatencyMonitor.cpp
+*   Created on: Oct 19, 2026
+*   Histogram of the time from the capture of the samples to their plot on the display.
+*/
+#include "LatencyMonitor.h"
+
+//Functions
+
+/*
+*   Function to set up the monitor with an empty histogram.
+*   Input: LatencyMonitor *L - The monitor.
+*   Output: None.
+*/
+void InitializeLatencyMonitor(LatencyMonitor *L){
+  for(int i = 0; i < LATENCY_HIST_BINS; i++){
+    L->Histogram[i] = 0;
+  }
+  L->Count = 0;
+  L->Missed = 0;
+  L->Sum = 0;
+  L->Min = 0;
+  L->Max = 0;
+}
+
+/*
+*   Function to add a latency to the histogram.
+*   Input: LatencyMonitor *L - The monitor.
+*   Input: unsigned long Us - The latency(us).
+*   Output: None.
+*/
+void RecordLatency(LatencyMonitor *L, unsigned long Us){
+  unsigned long Bin = Us / LATENCY_HIST_BIN_US;
+  L->Histogram[(Bin < LATENCY_HIST_BINS)? Bin : LATENCY_HIST_BINS - 1]++;
+  L->Min = (L->Count == 0 || Us < L->Min)? Us : L->Min;
+  L->Max = (Us > L->Max)? Us : L->Max;
+  L->Sum += Us;
+  L->Count++;
+}
+
+/*
+*   Function to get a percentile of the latency from the histogram.
+*   Input: const LatencyMonitor *L - The monitor.
+*   Input: float Fraction - Share of the latencies that are at or below the result, 0.5 for the median.
+*   Output: unsigned long - Upper edge(us) of the bin the percentile falls in, Max if that is the last bin. 0 if nothing was recorded.
+*/
+unsigned long LatencyPercentile(const LatencyMonitor *L, float Fraction){
+  if(L->Count == 0){
+    return 0;
+  }
+  unsigned long Target = (unsigned long)(Fraction * L->Count + 0.5);
+  unsigned long Seen = 0;
+  for(int i = 0; i < LATENCY_HIST_BINS - 1; i++){
+    Seen += L->Histogram[i];
+    if(Seen >= Target){
+      unsigned long Edge = (i + 1) * (unsigned long)LATENCY_HIST_BIN_US;
+      return (Edge < L->Max)? Edge : L->Max;
+    }
+  }
+  return L->Max;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to print the latency statistics to the Serial object.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const LatencyMonitor *L - The monitor.
+*   Input: const char *Name - What was measured.
+*   Input: unsigned long WindowUs - Length of a capture if the latency is from its newest sample, the oldest one is that much older. 0 to leave it out.
+*   Output: None.
+*/
+void PrintLatencyStats(Stream &Serial, const LatencyMonitor *L, const char *Name, unsigned long WindowUs){
+  Serial.printf("----%s Latency----\n", Name);
+  Serial.printf("Frames %lu, missed %lu, min %lu us, mean %.0f us, max %lu us\n", L->Count, L->Missed, L->Min, (L->Count > 0)? L->Sum / L->Count : 0.0, L->Max);
+  Serial.printf("Median <= %lu us, 95%% <= %lu us\n", LatencyPercentile(L, 0.5), LatencyPercentile(L, 0.95));
+  if(WindowUs > 0){
+    Serial.printf("From the newest sample of a capture, the oldest adds %lu us\n", WindowUs);
+  }
+  for(int i = 0; i < LATENCY_HIST_BINS; i++){
+    if(L->Histogram[i] == 0){
+      continue;
+    }
+    if(i < LATENCY_HIST_BINS - 1){
+      Serial.printf("%3d-%3d ms: %lu\n", i * LATENCY_HIST_BIN_US / 1000, (i + 1) * LATENCY_HIST_BIN_US / 1000, L->Histogram[i]);
+    }
+    else{
+      Serial.printf("  >%3d ms: %lu\n", i * LATENCY_HIST_BIN_US / 1000, L->Histogram[i]);
+    }
+  }
+}
+#endif
@@ -0,0 +1,43 @@
+/*
+    * LatencyMonitor.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the latency monitor. Every frame carries the
+    *  time the DMA completed its capture, and when its plot has been pushed
+    *  to the display the age of the capture goes into a histogram. The same
+    *  monitor also takes the latency test, where an impulse is fed in through
+    *  a synthetic source and timed until the beat it makes is on the screen.
+    *  The logic gets the time passed in and does not depend on the ESP32.
+    *
+*/
+#ifndef _LATENCYMONITOR_H
+#define _LATENCYMONITOR_H
+
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define LATENCY_HIST_BINS 16                    //Bins of the latency histogram
+#define LATENCY_HIST_BIN_US 20000               //Width of a bin(us), the last bin also holds all longer latencies
+#define LATENCY_TEST_PERIOD 16                  //Captures between two impulses of the latency test, about 1.5 s
+#define LATENCY_TEST_AMPLITUDE 1500.0           //Height of the impulse(ADC counts)
+
+struct LatencyMonitor{
+  unsigned long Histogram[LATENCY_HIST_BINS];
+  unsigned long Count;                          //Latencies recorded
+  unsigned long Missed;                         //Latency test: impulses drawn without being detected, or never drawn
+  double Sum;                                   //Sum of the latencies(us), for the mean
+  unsigned long Min;
+  unsigned long Max;
+};
+
+//Function Prototypes
+void          InitializeLatencyMonitor(LatencyMonitor *L);
+void          RecordLatency(LatencyMonitor *L, unsigned long Us);
+unsigned long LatencyPercentile(const LatencyMonitor *L, float Fraction);
+#ifdef ARDUINO
+void          PrintLatencyStats(Stream &Serial, const LatencyMonitor *L, const char *Name, unsigned long WindowUs);
+#endif
+#endif //_LATENCYMONITOR_H
@@ -0,0 +1,128 @@
+/*
+*   MemoryArena.cpp
+*   Created on: Oct 19, 2026
+*   Holds the static arena all pipeline buffers are carved from and the memory report.
+*/
+#include "MemoryArena.h"
+
+//One allocation made from the arena, kept for the memory report.
+struct ArenaEntry{
+  const char *Name;
+  ArenaCategory Category;
+  size_t Size;
+};
+
+static uint8_t Arena[ARENA_SIZE] __attribute__((aligned(ARENA_ALIGN)));
+static size_t ArenaOffset = 0;
+static ArenaEntry ArenaEntries[ARENA_MAX_ENTRIES];
+static int ArenaEntryCount = 0;
+
+//The budget from MemoryArena.h, fixed at build time.
+static const ArenaEntry MemoryBudget[] = {
+  {"FFT config",       ARENA_FFT,     ARENA_BUDGET_FFT_CONFIG},
+  {"Twiddle factors",  ARENA_FFT,     ARENA_BUDGET_TWIDDLES},
+  {"Pruned FFT masks", ARENA_FFT,     ARENA_BUDGET_PRUNE_MASKS},
+  {"i2s read buffer",  ARENA_SAMPLES, ARENA_BUDGET_RAW_SAMPLES},
+  {"FIR filter",       ARENA_SAMPLES, ARENA_BUDGET_FILTER},
+  {"Filtered samples", ARENA_SAMPLES, ARENA_BUDGET_FILTERED},
+  {"Frame samples",    ARENA_SAMPLES, ARENA_BUDGET_SAMPLES},
+  {"Spectra",          ARENA_SPECTRA, ARENA_BUDGET_SPECTRA},
+  {"Dual FFT packing", ARENA_SPECTRA, ARENA_BUDGET_DUAL_FFT},
+  {"Beat history",     ARENA_SPECTRA, ARENA_BUDGET_BEAT},
+  {"Partial tracker",  ARENA_SAMPLES, ARENA_BUDGET_PARTIALS},
+  {"Pitch map",        ARENA_DISPLAY, ARENA_BUDGET_PITCH_MAP},
+  {"Multi-resolution", ARENA_SPECTRA, ARENA_BUDGET_MULTIRES},
+  {"Autocorrelation",  ARENA_SPECTRA, ARENA_BUDGET_PITCH},
+  {"Event history",    ARENA_SAMPLES, ARENA_BUDGET_EVENTS},
+  {"Trigger history",  ARENA_SAMPLES, ARENA_BUDGET_TRIGGER},
+  {"Frame display",    ARENA_DISPLAY, ARENA_BUDGET_DISPLAY},
+  {"Frame pool",       ARENA_OTHER,   ARENA_BUDGET_FRAMES},
+  {"Task stacks+TCBs", ARENA_STACKS,  ARENA_BUDGET_STACKS},
+};
+
+static const char *CategoryNames[ARENA_CATEGORY_COUNT] = {"FFT", "Samples", "Spectra", "Display", "Stacks", "Other"};
+
+//Functions
+
+/*
+*   Function to carve a buffer out of the arena.
+*   There is no free, everything is allocated once during setup and lives forever.
+*   Input: size_t Size - Size of the buffer in bytes.
+*   Input: const char *Name - Name of the buffer for the memory report.
+*   Input: ArenaCategory Category - What the buffer is used for.
+*   Output: void * - The buffer, zero filled. Halts if the arena is exhausted, i.e. the budget in MemoryArena.h is wrong.
+*/
+void *ArenaAlloc(size_t Size, const char *Name, ArenaCategory Category){
+  size_t Start = (ArenaOffset + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  if((Start + Size > ARENA_SIZE) || (ArenaEntryCount == ARENA_MAX_ENTRIES)){
+    Serial.printf("Arena exhausted allocating %u bytes for %s\n", (unsigned)Size, Name);
+    while(1);
+  }
+  ArenaEntries[ArenaEntryCount].Name = Name;
+  ArenaEntries[ArenaEntryCount].Category = Category;
+  ArenaEntries[ArenaEntryCount].Size = Size;
+  ArenaEntryCount++;
+  ArenaOffset = Start + Size;
+  memset(&Arena[Start], 0, Size);
+  return &Arena[Start];
+}
+
+/*
+*   Function to get how much of the arena is in use.
+*   Input: None.
+*   Output: size_t - Bytes used, including alignment padding.
+*/
+size_t ArenaUsed(){
+  return ArenaOffset;
+}
+
+/*
+*   Function to get the start of the arena, to find out which RAM it was placed in.
+*   Input: None.
+*   Output: const void * - The arena.
+*/
+const void *ArenaBase(){
+  return Arena;
+}
+
+/*
+*   Function to create a task pinned to a core with its stack and control block carved from the arena.
+*   Input: TaskFunction_t Code - The task function.
+*   Input: const char *Name - Name of the task, also used in the memory report.
+*   Input: uint32_t StackSize - Stack size in bytes.
+*   Input: UBaseType_t Priority - Priority of the task.
+*   Input: BaseType_t Core - Core the task is pinned to.
+*   Output: TaskHandle_t - Handle to the task.
+*/
+TaskHandle_t CreateStaticTask(TaskFunction_t Code, const char *Name, uint32_t StackSize, UBaseType_t Priority, BaseType_t Core){
+  StackType_t *Stack = (StackType_t *)ArenaAlloc(StackSize, Name, ARENA_STACKS);
+  StaticTask_t *TCB = (StaticTask_t *)ArenaAlloc(sizeof(StaticTask_t), Name, ARENA_STACKS);
+  return xTaskCreateStaticPinnedToCore(Code, Name, StackSize, NULL, Priority, Stack, TCB, Core);
+}
+
+/*
+*   Function to print the footprint of every buffer to the Serial object.
+*   Lists the build time budget, every arena allocation, the totals per category and the i2s DMA memory that lives outside the arena.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Output: None.
+*/
+void PrintMemoryReport(Stream &Serial){
+  size_t Totals[ARENA_CATEGORY_COUNT] = {0};
+  Serial.println("----Memory Report----");
+  Serial.println("--Build time budget--");
+  for(unsigned i = 0; i < sizeof(MemoryBudget)/sizeof(MemoryBudget[0]); i++){
+    Serial.printf("%-24s %-8s %6u\n", MemoryBudget[i].Name, CategoryNames[MemoryBudget[i].Category], (unsigned)MemoryBudget[i].Size);
+  }
+  Serial.println("--Allocated--");
+  for(int i = 0; i < ArenaEntryCount; i++){
+    Serial.printf("%-24s %-8s %6u\n", ArenaEntries[i].Name, CategoryNames[ArenaEntries[i].Category], (unsigned)ArenaEntries[i].Size);
+    Totals[ArenaEntries[i].Category] += ArenaEntries[i].Size;
+  }
+  Serial.println("--Per category--");
+  for(int i = 0; i < ARENA_CATEGORY_COUNT; i++){
+    Serial.printf("%-8s %6u\n", CategoryNames[i], (unsigned)Totals[i]);
+  }
+  Serial.printf("Arena used %u of %u bytes\n", (unsigned)ArenaOffset, (unsigned)ARENA_SIZE);
+  Serial.printf("i2s DMA buffers %u bytes, descriptors %u bytes (driver heap)\n", (unsigned)DMA_BUFFER_BYTES, (unsigned)DMA_DESCRIPTOR_BYTES);
+  Serial.println("----Memory Report Finished----");
+}
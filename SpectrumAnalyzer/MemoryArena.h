@@ -0,0 +1,98 @@
+/*
+    * MemoryArena.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the memory budget of the whole pipeline and the
+    *  statically sized arena every pipeline buffer is carved from, so nothing
+    *  touches the heap after setup.
+    *  
+*/
+#ifndef _MEMORYARENA_H
+#define _MEMORYARENA_H
+
+#include <Arduino.h>
+#include "SignalSampler.h"
+#include "DisplayFunctions.h"
+#include "FramePipeline.h"
+#include "PitchMap.h"
+#include "MultiResolution.h"
+#include "EventRecorder.h"
+
+//Defines
+#define ARENA_ALIGN 8                                   //Every allocation starts on this boundary
+#define ARENA_MAX_ENTRIES 28                            //Allocations tracked for the memory report
+#define ARENA_SIZE_LIMIT 120000                         //Build fails if the budget grows beyond this (static DRAM is limited)
+
+//Task stacks, in bytes (StackType_t is a byte on the ESP32)
+#define TASK_STACK_ACQUISITION 4096
+#define TASK_STACK_PROCESSING 10000
+#define TASK_STACK_VISUALIZATION 10000
+#define TASK_STACK_LOOP 8192                            //Stack arduino gives setup() and loop(), not from the arena
+
+//Budget of every buffer in the arena, in bytes
+#define ARENA_BUDGET_FFT_CONFIG   (sizeof(fft_config_t))
+#define ARENA_BUDGET_TWIDDLES     (2 * BUFFER_SIZE * sizeof(float))
+#define ARENA_BUDGET_RAW_SAMPLES  (ADC_CHANNEL_COUNT * BUFFER_SIZE * sizeof(int16_t))
+#define ARENA_BUDGET_DUAL_FFT     (DUAL_CHANNEL * (2 * BUFFER_SIZE * sizeof(float) + BUFFER_SIZE * sizeof(unsigned short)))   //Packing of ComputeDualFFT(), transformed in place, and its bit-reversal table
+#define ARENA_BUDGET_PRUNE_MASKS  (BUFFER_SIZE + sizeof(fft_pruned_plan_t))      //rfft_pruned_mask_size(n) is n bytes
+#define ARENA_BUDGET_FILTER       ((FILTER_OUTPUT || FILTER_DISPLAY) * FILTER_BUFFER_FLOATS * sizeof(float))   //Overlap-save buffers and filter spectrum
+#define ARENA_BUDGET_FILTERED     ((FILTER_OUTPUT && !FILTER_DISPLAY) * BUFFER_SIZE * sizeof(float))          //Filtered copy for the output, when the plots show the input
+#define ARENA_BUDGET_PARTIALS     (PARTIAL_HOP * sizeof(float))                   //End of the last frame for the partial tracker
+#define ARENA_BUDGET_BEAT         ((BUFFER_SIZE/2) * sizeof(float))               //Magnitudes of the last frame for the beat detector
+#define ARENA_BUDGET_PITCH_MAP    (BUFFER_SIZE * sizeof(PitchMapEntry))           //PitchMapMaxEntries() is two per bin
+#define ARENA_BUDGET_PITCH        ((1 - DUAL_CHANNEL) * BUFFER_SIZE * sizeof(float))   //Autocorrelation of the pitch detector, DUAL_CHANNEL lends it the dual FFT packing
+#define ARENA_BUDGET_MULTIRES     ((1 - DUAL_CHANNEL) * MULTIRES_BUFFER_FLOATS * sizeof(float))   //History and outputs of the multi-resolution plot
+#define ARENA_BUDGET_EVENTS       ((1 - DUAL_CHANNEL) * (EVENT_HISTORY_BYTES + BUFFER_SIZE * sizeof(int16_t)))   //Compressed history and a capture to decode it into, not with DUAL_CHANNEL
+#define ARENA_BUDGET_TRIGGER      (2 * BUFFER_SIZE * sizeof(float))               //End of the last capture for the trigger, twice the longest waveform window
+#define ARENA_BUDGET_FRAMES       (FRAME_POOL_SIZE * sizeof(Frame))
+#define ARENA_BUDGET_SAMPLES      (ADC_CHANNEL_COUNT * FRAME_POOL_SIZE * BUFFER_SIZE * sizeof(float))
+#define ARENA_BUDGET_SPECTRA      (ADC_CHANNEL_COUNT * BUFFER_SIZE * sizeof(float))            //One spectrum per input, only the processing task uses them
+#define ARENA_BUDGET_DISPLAY      (FRAME_POOL_SIZE * FFTPLOT_CHANNEL * sizeof(uint32_t))
+#define ARENA_BUDGET_STACKS       (TASK_STACK_ACQUISITION + TASK_STACK_PROCESSING + TASK_STACK_VISUALIZATION + 3 * sizeof(StaticTask_t))
+
+#define ARENA_SIZE  (ARENA_BUDGET_FFT_CONFIG     \
+                   + ARENA_BUDGET_TWIDDLES      \
+                   + ARENA_BUDGET_PRUNE_MASKS   \
+                   + ARENA_BUDGET_RAW_SAMPLES   \
+                   + ARENA_BUDGET_FILTER        \
+                   + ARENA_BUDGET_FILTERED      \
+                   + ARENA_BUDGET_DUAL_FFT      \
+                   + ARENA_BUDGET_BEAT          \
+                   + ARENA_BUDGET_PARTIALS      \
+                   + ARENA_BUDGET_PITCH_MAP     \
+                   + ARENA_BUDGET_MULTIRES      \
+                   + ARENA_BUDGET_PITCH         \
+                   + ARENA_BUDGET_EVENTS        \
+                   + ARENA_BUDGET_TRIGGER       \
+                   + ARENA_BUDGET_FRAMES        \
+                   + ARENA_BUDGET_SAMPLES       \
+                   + ARENA_BUDGET_SPECTRA       \
+                   + ARENA_BUDGET_DISPLAY       \
+                   + ARENA_BUDGET_STACKS        \
+                   + ARENA_ALIGN * ARENA_MAX_ENTRIES)
+
+static_assert(ARENA_SIZE <= ARENA_SIZE_LIMIT, "Pipeline memory budget is larger than ARENA_SIZE_LIMIT");
+
+//Memory owned by the i2s driver on the DMA capable heap, outside the arena.
+//Every DMA buffer has one 12 byte lldesc_t descriptor per 4092 bytes of data.
+#define DMA_BUFFER_BYTES      (I2S_DMA_BUF_COUNT * BUFFER_SIZE * sizeof(int16_t))
+#define DMA_DESCRIPTOR_BYTES  (I2S_DMA_BUF_COUNT * 12 * ((BUFFER_SIZE * sizeof(int16_t) + 4091) / 4092))
+
+//What a buffer is used for, the memory report is broken out by these.
+enum ArenaCategory{
+  ARENA_FFT,                                            //FFT configuration and twiddle factors
+  ARENA_SAMPLES,                                        //Raw and converted samples
+  ARENA_SPECTRA,                                        //FFT output and magnitudes
+  ARENA_DISPLAY,                                        //Display buffers
+  ARENA_STACKS,                                         //Task stacks and task control blocks
+  ARENA_OTHER,
+  ARENA_CATEGORY_COUNT
+};
+
+//Function Prototypes
+void   *ArenaAlloc(size_t Size, const char *Name, ArenaCategory Category);
+size_t  ArenaUsed();
+const void *ArenaBase();
+TaskHandle_t CreateStaticTask(TaskFunction_t Code, const char *Name, uint32_t StackSize, UBaseType_t Priority, BaseType_t Core);
+void    PrintMemoryReport(Stream &Serial);
+#endif //_MEMORYARENA_H
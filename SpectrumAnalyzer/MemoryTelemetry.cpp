@@ -0,0 +1,118 @@
+/*
+*   MemoryTelemetry.cpp
+*   Created on: Oct 19, 2026
+*   Samples the stack, heap and RAM counters of the memory telemetry.
+*/
+#include "MemoryTelemetry.h"
+#include <string.h>
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#include <soc/soc_memory_layout.h>
+#endif
+
+//Functions
+
+/*
+*   Function to set up the telemetry with no tasks watched.
+*   Input: MemoryTelemetry *T - The telemetry.
+*   Output: None.
+*/
+void InitializeMemoryTelemetry(MemoryTelemetry *T){
+  memset(T, 0, sizeof(MemoryTelemetry));
+}
+
+/*
+*   Function to add a task to the ones whose stack is watched. Tasks past TELEMETRY_MAX_TASKS are ignored.
+*   Input: MemoryTelemetry *T - The telemetry.
+*   Input: const char *Name - Name of the task for the report.
+*   Input: void *Handle - TaskHandle_t of the task.
+*   Input: uint32_t StackSize - Stack the task was created with(bytes).
+*   Output: None.
+*/
+void WatchTask(MemoryTelemetry *T, const char *Name, void *Handle, uint32_t StackSize){
+  if(T->TaskCount == TELEMETRY_MAX_TASKS || Handle == NULL){
+    return;
+  }
+  TaskTelemetry *Task = &T->Tasks[T->TaskCount++];
+  Task->Name = Name;
+  Task->Handle = Handle;
+  Task->StackSize = StackSize;
+  Task->StackFree = StackSize;
+}
+
+/*
+*   Function to sample all the counters. Cheap enough for the render task, but it takes the heap lock,
+*   so it should not run on every frame.
+*   Input: MemoryTelemetry *T - The telemetry.
+*   Input: const void *Arena - Start of the arena, to find out which RAM it is in.
+*   Input: size_t ArenaUsed, ArenaSize - Bytes of the arena in use and in total.
+*   Output: None.
+*/
+void SampleMemoryTelemetry(MemoryTelemetry *T, const void *Arena, size_t ArenaUsed, size_t ArenaSize){
+  T->Samples++;
+  T->ArenaUsed = ArenaUsed;
+  T->ArenaSize = ArenaSize;
+#ifdef ARDUINO
+  //The high-water mark is the least free stack since the task started, in bytes as StackType_t is a byte.
+  for(int i = 0; i < T->TaskCount; i++){
+    T->Tasks[i].StackFree = uxTaskGetStackHighWaterMark((TaskHandle_t)T->Tasks[i].Handle);
+  }
+  T->HeapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  T->HeapMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  T->HeapLargest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  T->DmaFree = heap_caps_get_free_size(MALLOC_CAP_DMA);
+  T->DmaLargest = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+  T->InternalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+  T->ExternalFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  T->ArenaDma = esp_ptr_dma_capable(Arena);
+  T->ArenaExternal = esp_ptr_external_ram(Arena);
+#else
+  //Host stub: there is no RTOS or heap to ask, the stacks stay unused and the heap empty.
+  (void)Arena;
+#endif
+  T->HeapFragmentation = HeapFragmentation(T->HeapFree, T->HeapLargest);
+}
+
+/*
+*   Function to get how fragmented a heap is.
+*   Input: size_t Free - Free bytes of the heap.
+*   Input: size_t Largest - Largest free block.
+*   Output: float - Share of the free bytes outside the largest block(%), 0 for an empty heap.
+*/
+float HeapFragmentation(size_t Free, size_t Largest){
+  return (Free > 0)? 100.0 * (Free - Largest) / Free : 0.0;
+}
+
+/*
+*   Function to get the stack a task needs, the deepest it has been plus TELEMETRY_STACK_MARGIN,
+*   rounded up to 256 bytes. Only meaningful after the task went through all its paths (every plot mode).
+*   Input: const TaskTelemetry *Task - The task.
+*   Output: uint32_t - Suggested stack size(bytes).
+*/
+uint32_t SuggestedStackSize(const TaskTelemetry *Task){
+  uint32_t Used = Task->StackSize - Task->StackFree;
+  return (Used + TELEMETRY_STACK_MARGIN + 255) & ~(uint32_t)255;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to print the last sample of the telemetry to the Serial object.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const MemoryTelemetry *T - The telemetry.
+*   Output: None.
+*/
+void PrintMemoryTelemetry(Stream &Serial, const MemoryTelemetry *T){
+  Serial.println("----Memory Telemetry----");
+  for(int i = 0; i < T->TaskCount; i++){
+    const TaskTelemetry *Task = &T->Tasks[i];
+    Serial.printf("%-18s stack %5u, high-water %5u used, suggested %5u\n", Task->Name, (unsigned)Task->StackSize,
+                  (unsigned)(Task->StackSize - Task->StackFree), (unsigned)SuggestedStackSize(Task));
+  }
+  Serial.printf("Heap free %u (min %u), largest block %u, fragmentation %.1f%%\n", (unsigned)T->HeapFree, (unsigned)T->HeapMinFree,
+                (unsigned)T->HeapLargest, T->HeapFragmentation);
+  Serial.printf("DMA free %u, largest block %u\n", (unsigned)T->DmaFree, (unsigned)T->DmaLargest);
+  Serial.printf("Internal free %u, external free %u\n", (unsigned)T->InternalFree, (unsigned)T->ExternalFree);
+  Serial.printf("Arena %u of %u bytes, in %s RAM\n", (unsigned)T->ArenaUsed, (unsigned)T->ArenaSize,
+                T->ArenaExternal? "external" : (T->ArenaDma? "DMA capable internal" : "internal"));
+}
+#endif
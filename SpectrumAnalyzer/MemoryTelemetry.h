@@ -0,0 +1,61 @@
+/*
+    * MemoryTelemetry.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the memory telemetry. Every so often it samples
+    *  the stack high-water mark of every task, the free heap and its largest
+    *  block, the DMA capable, internal and external RAM and where the arena
+    *  lives, so stacks and buffers can be sized from what is actually used.
+    *  On the host the readings come from a stub and stay at zero.
+    *
+*/
+#ifndef _MEMORYTELEMETRY_H
+#define _MEMORYTELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define TELEMETRY_MAX_TASKS 4                   //Tasks that can be watched
+#define TELEMETRY_INTERVAL 100                  //Rendered frames between two samples
+#define TELEMETRY_STACK_MARGIN 1024             //Headroom added to the deepest stack seen for the suggested size(bytes)
+
+//Stack use of one task
+struct TaskTelemetry{
+  const char *Name;
+  void *Handle;                                 //TaskHandle_t of the task
+  uint32_t StackSize;                           //Stack it was created with(bytes)
+  uint32_t StackFree;                           //Least free stack it has ever had, the high-water mark(bytes)
+};
+
+struct MemoryTelemetry{
+  TaskTelemetry Tasks[TELEMETRY_MAX_TASKS];
+  int TaskCount;
+  unsigned long Samples;                        //Times the counters were sampled
+  size_t HeapFree;                              //8 bit capable heap
+  size_t HeapMinFree;                           //Least free heap since boot
+  size_t HeapLargest;                           //Largest block that can be allocated in one go
+  float HeapFragmentation;                      //Share of the free heap that is not in the largest block(%)
+  size_t DmaFree;                               //DMA capable heap, the i2s buffers come from here
+  size_t DmaLargest;
+  size_t InternalFree;                          //Internal RAM
+  size_t ExternalFree;                          //PSRAM, 0 if the board has none
+  size_t ArenaUsed;
+  size_t ArenaSize;
+  bool ArenaDma;                                //The arena is in DMA capable internal RAM
+  bool ArenaExternal;                           //The arena is in PSRAM
+};
+
+//Function Prototypes
+void     InitializeMemoryTelemetry(MemoryTelemetry *T);
+void     WatchTask(MemoryTelemetry *T, const char *Name, void *Handle, uint32_t StackSize);
+void     SampleMemoryTelemetry(MemoryTelemetry *T, const void *Arena, size_t ArenaUsed, size_t ArenaSize);
+float    HeapFragmentation(size_t Free, size_t Largest);
+uint32_t SuggestedStackSize(const TaskTelemetry *Task);
+#ifdef ARDUINO
+void     PrintMemoryTelemetry(Stream &Serial, const MemoryTelemetry *T);
+#endif
+#endif //_MEMORYTELEMETRY_H
@@ -0,0 +1,150 @@
+/*
+*   MultiResolution.cpp
+*   Created on: Oct 19, 2026
+*   Long FFT for the bass, short FFT for the treble, merged into one set of bars.
+*/
+#include "MultiResolution.h"
+#include "FFT.h"
+#include <string.h>
+
+//Functions
+
+/*
+*   Function to get the bins of a FFT that fall between two frequencies.
+*   A bar narrower than a bin still gets the bin nearest to it.
+*   Input: float FreqLow, FreqHigh - Edges of the bar(Hz).
+*   Input: float BinHz - Bin spacing of the FFT.
+*   Input: int Size - FFT size.
+*   Output: MultiResBar - The bins.
+*/
+static MultiResBar BarBins(float FreqLow, float FreqHigh, float BinHz, int Size){
+  int Start = (int)(FreqLow / BinHz + 0.5);
+  int End = (int)(FreqHigh / BinHz + 0.5) - 1;
+  if(End < Start){
+    Start = End = (int)((FreqLow + FreqHigh) / (2 * BinHz) + 0.5);
+  }
+  Start = (Start < 1)? 1 : Start;
+  End = (End > Size/2 - 1)? Size/2 - 1 : End;
+  End = (End < Start)? Start : End;
+  MultiResBar Bar = {(uint16_t)Start, (uint16_t)End};
+  return Bar;
+}
+
+/*
+*   Function to plan the multi-resolution spectrum.
+*   The bars are log spaced, so the bass bars are only a few Hz wide and the treble bars a few hundred.
+*   A bar comes from the long FFT as long as it is narrower than a bin of the short FFT and below
+*   the passband of the decimation filter, the rest come from the short FFT.
+*   Input: MultiResolution *M - The plan to fill in.
+*   Input: float *Buffer - Memory for MULTIRES_BUFFER_FLOATS floats.
+*   Input: float *LongTwiddles - Twiddle factors of a MULTIRES_LONG_SIZE FFT (the main FFT has them).
+*   Input: int Channel - Number of bars, at most MULTIRES_MAX_BARS.
+*   Input: float FreqStart, FreqEnd - Range of the bars(Hz).
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Output: MultiResolution * - The plan.
+*/
+MultiResolution *InitializeMultiResolution(MultiResolution *M, float *Buffer, float *LongTwiddles, int Channel, float FreqStart, float FreqEnd, float SampleRate){
+  memset(Buffer, 0, MULTIRES_BUFFER_FLOATS * sizeof(float));
+  M->History = Buffer;
+  M->LongOutput = M->History + MULTIRES_LONG_SIZE;
+  M->ShortOutput = M->LongOutput + MULTIRES_LONG_SIZE;
+  M->ShortTwiddles = M->ShortOutput + MULTIRES_SHORT_SIZE;
+  M->Delay = M->ShortTwiddles + 2 * MULTIRES_SHORT_SIZE;
+  M->LongTwiddles = LongTwiddles;
+  fft_config_t ShortFFT;
+  fft_init_static(&ShortFFT, M->ShortTwiddles, MULTIRES_SHORT_SIZE, FFT_REAL, FFT_FORWARD, M->History, M->ShortOutput);
+
+  //Windowed sinc (Hamming) low pass at the decimated Nyquist frequency, with unity gain at DC.
+  float Cutoff = 0.5 / MULTIRES_DECIMATION;     //Cycles per sample
+  float Centre = (MULTIRES_TAPS - 1) / 2.0;
+  float Sum = 0;
+  for(int k = 0; k < MULTIRES_TAPS; k++){
+    float t = k - Centre;
+    float Sinc = 2 * Cutoff * sinf(TWO_PI * Cutoff * t) / (TWO_PI * Cutoff * t);
+    M->Taps[k] = Sinc * (0.54 - 0.46 * cosf(TWO_PI * k / (MULTIRES_TAPS - 1)));
+    Sum += M->Taps[k];
+  }
+  for(int k = 0; k < MULTIRES_TAPS; k++){
+    M->Taps[k] /= Sum;
+  }
+
+  M->Channel = (Channel > MULTIRES_MAX_BARS)? MULTIRES_MAX_BARS : Channel;
+  M->LongBinHz = SampleRate / MULTIRES_DECIMATION / MULTIRES_LONG_SIZE;
+  M->ShortBinHz = SampleRate / MULTIRES_SHORT_SIZE;
+  float LongLimit = MULTIRES_LONG_PASSBAND * SampleRate / (2 * MULTIRES_DECIMATION);
+  float Ratio = powf(FreqEnd / FreqStart, 1.0 / M->Channel);
+  float FreqLow = FreqStart;
+  M->CrossoverBar = M->Channel;
+  for(int i = 0; i < M->Channel; i++){
+    float FreqHigh = FreqLow * Ratio;
+    if(M->CrossoverBar == M->Channel && (FreqHigh - FreqLow >= M->ShortBinHz || FreqHigh > LongLimit)){
+      M->CrossoverBar = i;
+    }
+    if(i < M->CrossoverBar){
+      M->Bars[i] = BarBins(FreqLow, FreqHigh, M->LongBinHz, MULTIRES_LONG_SIZE);
+    }
+    else{
+      M->Bars[i] = BarBins(FreqLow, FreqHigh, M->ShortBinHz, MULTIRES_SHORT_SIZE);
+    }
+    FreqLow = FreqHigh;
+  }
+  return M;
+}
+
+/*
+*   Function to get the height of every bar from the magnitudes of one FFT output.
+*   A bar is the loudest bin in it, so a tone is as tall in a one bin bar as in a wide one.
+*   Input: const MultiResolution *M - The plan.
+*   Input: const float *Spectrum - The rfft output.
+*   Input: int First, Last - The bars to fill.
+*   Input: float Scale - Brings the magnitudes to the scale of a BUFFER_SIZE FFT.
+*   Input: uint32_t *DisplayData - The bars.
+*   Output: None.
+*/
+static void FillBars(const MultiResolution *M, const float *Spectrum, int First, int Last, float Scale, uint32_t *DisplayData){
+  for(int i = First; i < Last; i++){
+    float Peak = 0;
+    for(int b = M->Bars[i].BinStart; b <= M->Bars[i].BinEnd; b++){
+      float Power = Spectrum[2*b] * Spectrum[2*b] + Spectrum[2*b+1] * Spectrum[2*b+1];
+      Peak = (Power > Peak)? Power : Peak;
+    }
+    DisplayData[i] = sqrtf(Peak) * Scale;
+  }
+}
+
+/*
+*   Function to add a frame to the history and compute the bars.
+*   The frame is low pass filtered and decimated onto the end of the history, then the long FFT
+*   runs over the whole history and the short FFT over the newest MULTIRES_SHORT_SIZE samples.
+*   Input: MultiResolution *M - The plan.
+*   Input: const float *Samples - The sampled data of the frame.
+*   Input: int Count - Samples in the frame, a multiple of MULTIRES_DECIMATION and at least MULTIRES_SHORT_SIZE.
+*   Input: uint32_t *DisplayData - Set to the bar heights, in the same units as SpectrumPipeline::PrepareBars().
+*   Output: int - Number of bars.
+*/
+int ComputeMultiResolution(MultiResolution *M, const float *Samples, int Count, uint32_t *DisplayData){
+  //1. Decimate onto the end of the history. Samples before the frame come from the delay line.
+  int New = Count / MULTIRES_DECIMATION;
+  New = (New > MULTIRES_LONG_SIZE)? MULTIRES_LONG_SIZE : New;
+  memmove(M->History, M->History + New, (MULTIRES_LONG_SIZE - New) * sizeof(float));
+  float *Out = M->History + MULTIRES_LONG_SIZE - New;
+  for(int j = 0; j < New; j++){
+    int n = (j + 1) * MULTIRES_DECIMATION - 1;  //Newest input sample of this output
+    float Acc = 0;
+    for(int k = 0; k < MULTIRES_TAPS; k++){
+      int Index = n - k;
+      Acc += M->Taps[k] * ((Index >= 0)? Samples[Index] : M->Delay[MULTIRES_TAPS - 1 + Index]);
+    }
+    Out[j] = Acc;
+  }
+  memcpy(M->Delay, Samples + Count - (MULTIRES_TAPS - 1), (MULTIRES_TAPS - 1) * sizeof(float));
+
+  //2. Both FFTs, the short one on the newest samples of the frame.
+  rfft(M->History, M->LongOutput, M->LongTwiddles, MULTIRES_LONG_SIZE);
+  rfft((float *)Samples + Count - MULTIRES_SHORT_SIZE, M->ShortOutput, M->ShortTwiddles, MULTIRES_SHORT_SIZE);
+
+  //3. Merge. A tone gives the same magnitude in the long FFT as in the main FFT, the short FFT is scaled up to match.
+  FillBars(M, M->LongOutput, 0, M->CrossoverBar, 1.0, DisplayData);
+  FillBars(M, M->ShortOutput, M->CrossoverBar, M->Channel, (float)MULTIRES_LONG_SIZE / MULTIRES_SHORT_SIZE, DisplayData);
+  return M->Channel;
+}
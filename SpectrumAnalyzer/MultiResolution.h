@@ -0,0 +1,49 @@
+/*
+    * MultiResolution.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the multi-resolution spectrum. The bass comes from a
+    *  long FFT of the signal decimated over the last few frames, the treble from
+    *  a short FFT of the newest samples, and both are merged into one set of log
+    *  spaced bars. Does not depend on the ESP32.
+    *
+*/
+#ifndef _MULTIRESOLUTION_H
+#define _MULTIRESOLUTION_H
+
+#include <stdint.h>
+
+//Defines
+#define MULTIRES_DECIMATION 4                   //The long FFT runs at the sample rate divided by this
+#define MULTIRES_LONG_SIZE 1024                 //Decimated samples in the long FFT, MULTIRES_DECIMATION frames of 1024 samples
+#define MULTIRES_SHORT_SIZE 256                 //Newest samples in the short FFT
+#define MULTIRES_TAPS 32                        //Taps of the anti-alias filter in front of the decimation
+#define MULTIRES_LONG_PASSBAND 0.55             //Share of the decimated Nyquist frequency the long FFT is used up to (the filter rolls off above)
+#define MULTIRES_MAX_BARS 80                    //Most bars the plan can hold, must not be less than FFTPLOT_CHANNEL
+#define MULTIRES_BUFFER_FLOATS (2 * MULTIRES_LONG_SIZE + 3 * MULTIRES_SHORT_SIZE + MULTIRES_TAPS)   //Size of the buffer handed to InitializeMultiResolution()
+
+//Bins of one bar, in the FFT given by MultiResolution.CrossoverBar
+struct MultiResBar{
+  uint16_t BinStart;
+  uint16_t BinEnd;
+};
+
+struct MultiResolution{
+  float *History;                               //Decimated samples of the last frames, oldest first, the long FFT input
+  float *LongOutput;                            //MULTIRES_LONG_SIZE
+  float *ShortOutput;                           //MULTIRES_SHORT_SIZE
+  float *LongTwiddles;                          //Twiddle factors of a MULTIRES_LONG_SIZE FFT, shared with the main FFT
+  float *ShortTwiddles;                         //Twiddle factors of a MULTIRES_SHORT_SIZE FFT
+  float *Delay;                                 //Last MULTIRES_TAPS - 1 samples of the frame before, so the filter runs across frames
+  float Taps[MULTIRES_TAPS];                    //Low pass filter, cut off at the decimated Nyquist frequency
+  MultiResBar Bars[MULTIRES_MAX_BARS];
+  int Channel;                                  //Bars in use
+  int CrossoverBar;                             //Bars before this come from the long FFT, the rest from the short one
+  float LongBinHz;
+  float ShortBinHz;
+};
+
+//Function Prototypes
+MultiResolution *InitializeMultiResolution(MultiResolution *M, float *Buffer, float *LongTwiddles, int Channel, float FreqStart, float FreqEnd, float SampleRate);
+int   ComputeMultiResolution(MultiResolution *M, const float *Samples, int Count, uint32_t *DisplayData);
+#endif //_MULTIRESOLUTION_H
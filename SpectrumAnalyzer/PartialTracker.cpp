@@ -0,0 +1,141 @@
+/*
+*   PartialTracker.cpp
+*   Created on: Oct 19, 2026
+*   Top K spectral peaks with phase vocoder frequencies, followed across frames.
+*/
+#include "PartialTracker.h"
+#include "FFT.h"
+#include <string.h>
+
+//Functions
+
+/*
+*   Function to set up the partial tracker.
+*   Input: PartialTracker *T - The tracker.
+*   Input: float *Twiddles - Twiddle factors of a Size FFT (the main FFT has them).
+*   Input: float *Tail - PARTIAL_HOP floats, the end of the last frame is kept here.
+*   Input: int Size - FFT size.
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Input: int BinStart, BinEnd - Bins searched for peaks, they have to be computed by the FFT.
+*   Output: None.
+*/
+void InitializePartialTracker(PartialTracker *T, float *Twiddles, float *Tail, int Size, float SampleRate, int BinStart, int BinEnd){
+  T->Twiddles = Twiddles;
+  T->Tail = Tail;
+  T->Size = Size;
+  T->SampleRate = SampleRate;
+  T->BinStart = (BinStart < 1)? 1 : BinStart;
+  T->BinEnd = (BinEnd > Size/2 - 2)? Size/2 - 2 : BinEnd;
+  InitializePeakPicker(&T->Picker, PARTIAL_MIN_MAGNITUDE, PEAK_MIN_PROMINENCE, PEAK_MIN_SPACING);
+  T->LastSequence = 0;
+  T->HasTail = false;
+  T->NextId = 0;
+  T->Count = 0;
+}
+
+/*
+*   Function to get the DFT of one bin of the window PARTIAL_HOP samples before the frame,
+*   which is the kept tail of the last frame followed by the start of this one.
+*   Input: const PartialTracker *T - The tracker.
+*   Input: const float *Samples - Samples of this frame.
+*   Input: int Bin - The bin.
+*   Input: float *Re, *Im - Set to the DFT of the bin.
+*   Output: None.
+*/
+static void EarlierBin(const PartialTracker *T, const float *Samples, int Bin, float *Re, float *Im){
+  float SumRe = 0, SumIm = 0;
+  int Mask = T->Size - 1;
+  for(int n = 0; n < T->Size; n++){
+    float x = (n < PARTIAL_HOP)? T->Tail[n] : Samples[n - PARTIAL_HOP];
+    int t = (Bin * n) & Mask;
+    SumRe += x * T->Twiddles[2*t];
+    SumIm -= x * T->Twiddles[2*t + 1];
+  }
+  *Re = SumRe;
+  *Im = SumIm;
+}
+
+/*
+*   Function to find the partials of a frame.
+*   1. The PARTIAL_COUNT strongest peaks of the spectrum are picked by FindPeaks().
+*   2. If the last frame was the capture right before this one, each peak gets the frequency
+*      from its phase advance over PARTIAL_HOP samples. Otherwise it gets the interpolated bin frequency.
+*   3. Every peak takes the Id of the nearest partial of the last frame within PARTIAL_MATCH_BINS.
+*   Has to run on the complex FFT output, before SpectrumPipeline::Magnitudes() overwrites it.
+*   Input: PartialTracker *T - The tracker, Partials and Count are updated.
+*   Input: const float *Samples - Samples of the frame (the FFT input).
+*   Input: const float *Spectrum - The rfft of the samples.
+*   Input: unsigned long Sequence - Capture number of the frame, to spot dropped captures.
+*   Output: int - Number of partials found.
+*/
+int TrackPartials(PartialTracker *T, const float *Samples, const float *Spectrum, unsigned long Sequence){
+  //1. Strongest prominent peaks.
+  Partial Found[PARTIAL_COUNT];
+  SpectralPeak Peaks[PARTIAL_COUNT];
+  int Count = FindPeaks(&T->Picker, Spectrum, true, T->BinStart, T->BinEnd, Peaks, PARTIAL_COUNT);
+
+  //2. Frequency from the phase advance, the expected advance of the bin itself is taken off first.
+  bool Contiguous = T->HasTail && (Sequence == T->LastSequence + 1);
+  float BinHz = T->SampleRate / T->Size;
+  for(int i = 0; i < Count; i++){
+    int k = Peaks[i].Index;
+    Found[i].Magnitude = Peaks[i].Magnitude;
+    Found[i].Prominence = Peaks[i].Prominence;
+    Found[i].Frequency = Peaks[i].Bin * BinHz;
+    if(Contiguous){
+      float Re, Im;
+      EarlierBin(T, Samples, k, &Re, &Im);
+      float Advance = atan2f(Spectrum[2*k+1], Spectrum[2*k]) - atan2f(Im, Re) - TWO_PI * k * PARTIAL_HOP / T->Size;
+      Advance -= TWO_PI * floorf(Advance / TWO_PI + 0.5);           //Wrap to -pi..pi
+      Found[i].Frequency = (k + Advance * T->Size / (TWO_PI * PARTIAL_HOP)) * BinHz;
+    }
+  }
+
+  //3. Follow the partials of the last frame, the strongest peaks pick first.
+  bool Taken[PARTIAL_COUNT] = {false};
+  for(int i = 0; i < Count; i++){
+    int Match = -1;
+    float Nearest = PARTIAL_MATCH_BINS * BinHz;
+    for(int j = 0; j < T->Count; j++){
+      float Distance = fabsf(Found[i].Frequency - T->Partials[j].Frequency);
+      if(!Taken[j] && Distance < Nearest){
+        Nearest = Distance;
+        Match = j;
+      }
+    }
+    if(Match >= 0){
+      Taken[Match] = true;
+      Found[i].Id = T->Partials[Match].Id;
+      Found[i].Age = T->Partials[Match].Age + 1;
+    }
+    else{
+      Found[i].Id = T->NextId++;
+      Found[i].Age = 0;
+    }
+  }
+  memcpy(T->Partials, Found, Count * sizeof(Partial));
+  T->Count = Count;
+
+  memcpy(T->Tail, Samples + T->Size - PARTIAL_HOP, PARTIAL_HOP * sizeof(float));
+  T->LastSequence = Sequence;
+  T->HasTail = true;
+  return Count;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to print the partials of a frame to the Serial object, one line per partial, strongest first.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const Partial *Partials - The partials.
+*   Input: int Count - Number of partials.
+*   Input: unsigned long Sequence - Capture number of the frame.
+*   Output: None.
+*/
+void PrintPartials(Stream &Serial, const Partial *Partials, int Count, unsigned long Sequence){
+  Serial.printf("#Peaks of capture %lu: %d\n", Sequence, Count);
+  for(int i = 0; i < Count; i++){
+    Serial.printf("Partial %u: %.2f Hz, magnitude %.0f, prominence %.1f dB, %u frames\n", Partials[i].Id, Partials[i].Frequency,
+                  Partials[i].Magnitude, Partials[i].Prominence, Partials[i].Age);
+  }
+}
+#endif
@@ -0,0 +1,60 @@
+/*
+    * PartialTracker.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the partial tracker. It takes the strongest peaks of
+    *  every frame from the peak picker and measures their frequency from the phase advance between
+    *  the frame and a window PARTIAL_HOP samples earlier (phase vocoder), which
+    *  is far finer than the bin spacing (11000 / 1024, about 10.7 Hz, with the
+    *  defaults of the sketch). Peaks are followed from frame to frame.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _PARTIALTRACKER_H
+#define _PARTIALTRACKER_H
+
+#include <stdint.h>
+#include "PeakPicker.h"
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define PARTIAL_COUNT 8                         //Partials kept per frame (top K)
+#define PARTIAL_HOP 256                         //Samples between the two windows, a quarter of the FFT so +-2 bins can be told apart
+#define PARTIAL_MIN_MAGNITUDE 4500.0            //Peaks below this magnitude are noise (FFT_NOISE_THRESHOLD)
+#define PARTIAL_MATCH_BINS 1.0                  //A partial continues a partial of the last frame if they are closer than this(bins)
+
+static_assert(PARTIAL_COUNT <= PEAK_MAX_COUNT, "The peak picker has to find every partial");
+
+//One tonal component of a frame
+struct Partial{
+  float Frequency;                              //Instantaneous frequency(Hz)
+  float Magnitude;                              //Magnitude of its peak, interpolated between the bins
+  float Prominence;                             //Height of the peak above its valleys(dB)
+  uint16_t Id;                                  //Stays the same while the partial is followed from frame to frame
+  uint16_t Age;                                 //Frames it has been followed for
+};
+
+struct PartialTracker{
+  float *Twiddles;                              //Twiddle factors of a Size FFT, shared with the main FFT
+  float *Tail;                                  //Last PARTIAL_HOP samples of the last frame
+  int Size;                                     //FFT size
+  float SampleRate;
+  int BinStart;                                 //Bins searched for peaks
+  int BinEnd;
+  PeakPicker Picker;                            //Finds the peaks, PARTIAL_MIN_MAGNITUDE and the PEAK_ rules
+  unsigned long LastSequence;                   //Capture number of the frame Tail is from
+  bool HasTail;
+  uint16_t NextId;
+  Partial Partials[PARTIAL_COUNT];              //Partials of the last frame, strongest first
+  int Count;
+};
+
+//Function Prototypes
+void  InitializePartialTracker(PartialTracker *T, float *Twiddles, float *Tail, int Size, float SampleRate, int BinStart, int BinEnd);
+int   TrackPartials(PartialTracker *T, const float *Samples, const float *Spectrum, unsigned long Sequence);
+#ifdef ARDUINO
+void  PrintPartials(Stream &Serial, const Partial *Partials, int Count, unsigned long Sequence);
+#endif
+#endif //_PARTIALTRACKER_H
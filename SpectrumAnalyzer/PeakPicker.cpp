@@ -0,0 +1,211 @@
+/*
+*   PeakPicker.cpp
+*   Created on: Oct 19, 2026
+*   Top K prominent local maxima of a spectrum in one pass, interpolated to a fraction of a bin.
+*/
+#include "PeakPicker.h"
+#include <math.h>
+
+//A local maximum that has no higher one to its right yet, so its right valley is not known.
+struct OpenPeak{
+  float Level;
+  float Base;                                   //Lowest level between it and the nearest higher peak to its left (left valley)
+  float Low;                                    //Lowest level between it and the next open peak, or the current bin
+  int Bin;
+};
+
+//Functions
+
+/*
+*   Function to set up the peak picker.
+*   Input: PeakPicker *P - The picker.
+*   Input: float MinMagnitude - Peaks below this magnitude are noise.
+*   Input: float MinProminence - Least height(dB) above the higher of the two valleys.
+*   Input: int MinSpacing - Least distance(bins) between two peaks.
+*   Output: None.
+*/
+void InitializePeakPicker(PeakPicker *P, float MinMagnitude, float MinProminence, int MinSpacing){
+  P->MinMagnitude = MinMagnitude;
+  P->MinProminence = MinProminence;
+  P->MinSpacing = (MinSpacing < 1)? 1 : MinSpacing;
+}
+
+/*
+*   Function to get the level of a bin, the power of a complex spectrum or the magnitude itself.
+*   Only the order of the levels matters for the search, so the complex spectrum needs no square root.
+*   Input: const float *Spectrum - rfft layout if Complex, magnitudes by bin otherwise.
+*   Input: bool Complex - Layout of the spectrum.
+*   Input: int k - The bin.
+*   Output: float - The level.
+*/
+static inline float PeakLevel(const float *Spectrum, bool Complex, int k){
+  return Complex? Spectrum[2*k] * Spectrum[2*k] + Spectrum[2*k + 1] * Spectrum[2*k + 1] : Spectrum[k];
+}
+
+/*
+*   Function to get how far a tone lies from its peak bin, from the complex values of the bin and its
+*   neighbours (Jacobsen). The FFT is not windowed, for that this is within a few hundredths of a bin.
+*   Input: const float *Spectrum - The rfft layout.
+*   Input: int k - The peak bin, not the first or last one.
+*   Output: float - Offset(bins), -0.5 to 0.5.
+*/
+static float ComplexOffset(const float *Spectrum, int k){
+  float aRe = Spectrum[2*k - 2], aIm = Spectrum[2*k - 1];
+  float cRe = Spectrum[2*k + 2], cIm = Spectrum[2*k + 3];
+  float NumRe = aRe - cRe, NumIm = aIm - cIm;
+  float DenRe = 2 * Spectrum[2*k] - aRe - cRe, DenIm = 2 * Spectrum[2*k + 1] - aIm - cIm;
+  float Den = DenRe * DenRe + DenIm * DenIm;
+  float Offset = (Den > 0)? (NumRe * DenRe + NumIm * DenIm) / Den : 0;
+  return (Offset > 0.5f)? 0.5f : ((Offset < -0.5f)? -0.5f : Offset);
+}
+
+/*
+*   Function to offer a closed peak to the kept ones, the partial selection of the K strongest.
+*   A kept peak closer than the spacing that is as strong wins, weaker ones that close are dropped.
+*   When all K places are taken the weakest kept peak makes room if it is weaker.
+*   Input: OpenPeak *Kept - The kept peaks, in no order. Base is the higher of the two valleys.
+*   Input: int Count - Number of kept peaks.
+*   Input: int Max - Places for kept peaks.
+*   Input: const OpenPeak &Peak - The peak, with Base set like the kept ones.
+*   Input: int MinSpacing - Least distance(bins) between two peaks.
+*   Output: int - Number of kept peaks afterwards.
+*/
+static int KeepPeak(OpenPeak *Kept, int Count, int Max, const OpenPeak &Peak, int MinSpacing){
+  for(int i = 0; i < Count; i++){
+    int Distance = Kept[i].Bin - Peak.Bin;
+    if((Distance < 0? -Distance : Distance) < MinSpacing && Kept[i].Level >= Peak.Level){
+      return Count;
+    }
+  }
+  int Left = 0;
+  for(int i = 0; i < Count; i++){
+    int Distance = Kept[i].Bin - Peak.Bin;
+    if((Distance < 0? -Distance : Distance) >= MinSpacing){
+      Kept[Left++] = Kept[i];
+    }
+  }
+  if(Left < Max){
+    Kept[Left++] = Peak;
+    return Left;
+  }
+  int Weakest = 0;
+  for(int i = 1; i < Left; i++){
+    Weakest = (Kept[i].Level < Kept[Weakest].Level)? i : Weakest;
+  }
+  if(Kept[Weakest].Level < Peak.Level){
+    Kept[Weakest] = Peak;
+  }
+  return Left;
+}
+
+/*
+*   Function to find the strongest peaks of a spectrum.
+*   1. One pass over the bins. A local maximum at or above MinMagnitude is opened. Opening a peak closes
+*      the open peaks lower than it, the lowest level between them is their right valley and, for the new
+*      peak, the lowest level back to the nearest higher open peak (or the start of the band) is its left valley.
+*      The open peaks left at the end get the lowest level to the end of the band as their right valley.
+*      This is the prominence of a topographic map, quieter peaks than MinMagnitude are ignored as
+*      they can only bound the valleys of peaks that are quieter still.
+*   2. A closed peak that stands MinProminence above the higher of its valleys is offered to the kept
+*      peaks with KeepPeak(), which applies the spacing and keeps the Count strongest. No sort of the bins.
+*   3. The kept peaks are sorted, strongest first, and interpolated to a fraction of a bin. A complex spectrum
+*      uses ComplexOffset() and takes the scalloping off the magnitude, magnitudes get a parabola through the
+*      log magnitudes of the peak bin and its neighbours, which is good to about 0.2 bin without a window.
+*   Costs one level per bin and a few compares, plus a few logs per kept peak.
+*   Input: const PeakPicker *P - The picker.
+*   Input: const float *Spectrum - The rfft of the samples if Complex, otherwise the magnitude of every bin.
+*   Input: bool Complex - Layout of the spectrum.
+*   Input: int BinStart, BinEnd - Band searched, the peaks lie in between the two.
+*   Input: SpectralPeak *Peaks - Set to the peaks, strongest first.
+*   Input: int Count - Peaks wanted, at most PEAK_MAX_COUNT.
+*   Output: int - Number of peaks found.
+*/
+int FindPeaks(const PeakPicker *P, const float *Spectrum, bool Complex, int BinStart, int BinEnd, SpectralPeak *Peaks, int Count){
+  OpenPeak Open[PEAK_OPEN_PEAKS];
+  OpenPeak Kept[PEAK_MAX_COUNT];
+  int Opened = 0, Found = 0;
+  Count = (Count > PEAK_MAX_COUNT)? PEAK_MAX_COUNT : Count;
+  if(Count <= 0 || BinEnd - BinStart < 2){
+    return 0;
+  }
+  float MinLevel = Complex? P->MinMagnitude * P->MinMagnitude : P->MinMagnitude;
+  float Ratio = powf(10.0f, P->MinProminence / (Complex? 10.0f : 20.0f));          //Least level over the valley
+
+  //1. and 2. Open and close the peaks.
+  float Floor = PeakLevel(Spectrum, Complex, BinStart);                             //Lowest level up to the first open peak
+  float Prev = Floor;
+  float Cur = PeakLevel(Spectrum, Complex, BinStart + 1);
+  for(int k = BinStart + 1; k < BinEnd; k++){
+    float Next = PeakLevel(Spectrum, Complex, k + 1);
+    if(Cur > Prev && Cur >= Next && Cur >= MinLevel){
+      float Between = (Opened > 0)? Open[Opened - 1].Low : Floor;
+      //A full stack closes its lowest peak early, its right valley may come out too high which only errs towards dropping it.
+      while(Opened > 0 && (Open[Opened - 1].Level < Cur || Opened == PEAK_OPEN_PEAKS)){
+        OpenPeak Closed = Open[--Opened];
+        Closed.Base = (Closed.Base > Between)? Closed.Base : Between;
+        if(Closed.Level >= Closed.Base * Ratio){
+          Found = KeepPeak(Kept, Found, Count, Closed, P->MinSpacing);
+        }
+        float Low = (Opened > 0)? Open[Opened - 1].Low : Floor;
+        Between = (Low < Between)? Low : Between;
+      }
+      if(Opened > 0){
+        Open[Opened - 1].Low = Between;
+      }
+      else{
+        Floor = Between;
+      }
+      Open[Opened].Level = Cur;
+      Open[Opened].Base = Between;
+      Open[Opened].Low = Cur;
+      Open[Opened].Bin = k;
+      Opened++;
+    }
+    float *Low = (Opened > 0)? &Open[Opened - 1].Low : &Floor;
+    *Low = (Next < *Low)? Next : *Low;
+    Prev = Cur;
+    Cur = Next;
+  }
+  float Between = Cur;
+  while(Opened > 0){
+    OpenPeak Closed = Open[--Opened];
+    Between = (Closed.Low < Between)? Closed.Low : Between;
+    Closed.Base = (Closed.Base > Between)? Closed.Base : Between;
+    if(Closed.Level >= Closed.Base * Ratio){
+      Found = KeepPeak(Kept, Found, Count, Closed, P->MinSpacing);
+    }
+  }
+
+  //3. Strongest first, then interpolate.
+  for(int i = 1; i < Found; i++){
+    OpenPeak Peak = Kept[i];
+    int j = i;
+    for(; j > 0 && Kept[j - 1].Level < Peak.Level; j--){
+      Kept[j] = Kept[j - 1];
+    }
+    Kept[j] = Peak;
+  }
+  const float Tiny = 1e-20f;
+  for(int i = 0; i < Found; i++){
+    int k = Kept[i].Bin;
+    if(Complex){
+      Peaks[i].Bin = k + ComplexOffset(Spectrum, k);
+      float x = (float)M_PI * (Peaks[i].Bin - k);
+      Peaks[i].Magnitude = sqrtf(Kept[i].Level) * ((x != 0)? x / sinf(x) : 1.0f);
+      Peaks[i].Prominence = 10.0f * log10f(Kept[i].Level / (Kept[i].Base + Tiny));
+    }
+    else{
+      float a = logf(Spectrum[k - 1] + Tiny);
+      float b = logf(Kept[i].Level + Tiny);
+      float c = logf(Spectrum[k + 1] + Tiny);
+      float Curve = a - 2 * b + c;
+      float Offset = (Curve < 0)? 0.5f * (a - c) / Curve : 0;
+      Offset = (Offset > 0.5f)? 0.5f : ((Offset < -0.5f)? -0.5f : Offset);
+      Peaks[i].Bin = k + Offset;
+      Peaks[i].Magnitude = expf(b - 0.25f * (a - c) * Offset);
+      Peaks[i].Prominence = 20.0f * log10f(Kept[i].Level / (Kept[i].Base + Tiny));
+    }
+    Peaks[i].Index = k;
+  }
+  return Found;
+}
@@ -0,0 +1,41 @@
+/*
+    * PeakPicker.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the peak picker. In one pass over the bins it
+    *  finds the local maxima of a spectrum, measures how far each one stands
+    *  out from the valleys around it (prominence) and keeps the K strongest
+    *  that are loud enough, prominent enough and far enough apart. The kept
+    *  peaks are interpolated to a fraction of a bin.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _PEAKPICKER_H
+#define _PEAKPICKER_H
+
+#include <stdint.h>
+
+//Defines
+#define PEAK_MAX_COUNT 16                       //Most peaks one call can return
+#define PEAK_MIN_PROMINENCE 6.0                 //A peak has to stand this far(dB) above the higher of its two valleys
+#define PEAK_MIN_SPACING 3                      //Peaks closer than this(bins) are one peak, the stronger is kept. Takes out the first sidelobes as well
+#define PEAK_OPEN_PEAKS 16                      //Peaks still waiting for a higher peak to their right, a longer falling staircase closes the lowest early
+
+//One peak of a spectrum
+struct SpectralPeak{
+  float Bin;                                    //Interpolated position(bins)
+  float Magnitude;                              //Interpolated magnitude
+  float Prominence;                             //Height above the higher of its two valleys(dB)
+  uint16_t Index;                               //The bin of the local maximum
+};
+
+struct PeakPicker{
+  float MinMagnitude;                           //Quieter peaks are noise
+  float MinProminence;                          //dB
+  int MinSpacing;                               //Bins
+};
+
+//Function Prototypes
+void  InitializePeakPicker(PeakPicker *P, float MinMagnitude, float MinProminence, int MinSpacing);
+int   FindPeaks(const PeakPicker *P, const float *Spectrum, bool Complex, int BinStart, int BinEnd, SpectralPeak *Peaks, int Count);
+#endif //_PEAKPICKER_H
@@ -0,0 +1,115 @@
+/*
+*   PipelineBenchmark.cpp
+*   Created on: Oct 19, 2026
+*   Hands the stages of the sketch to RunPipelineTiming().
+*   The i2s driver is replaced by SignalGenerator and the display by a sprite in RAM,
+*   so the numbers only depend on the code and not on the signal or the SPI bus.
+*/
+#include "PipelineBenchmark.h"
+#include <esp_heap_caps.h>
+
+//What the stages work on, set for the run of the benchmark
+static Stream *BenchSerial;
+static TFT_eSPI *BenchDisplay;
+static fft_config_t *BenchFFT;
+static fft_pruned_plan_t *BenchPlan;
+static InputSpectrum BenchSpectrum;
+
+//Functions
+
+/*
+*   Function to get the number of heap blocks that are allocated right now.
+*   The allocator of the ESP32 does not count its calls, only this can be seen.
+*   Input: None.
+*   Output: long - Allocated blocks.
+*/
+static long AllocatedBlocks(){
+  multi_heap_info_t Info;
+  heap_caps_get_info(&Info, MALLOC_CAP_8BIT);
+  return Info.allocated_blocks;
+}
+
+static float BenchTransform(float *Samples, float *Spectrum){
+  BenchFFT->input = Samples;
+  BenchFFT->output = Spectrum;
+  ComputeFFT(BenchFFT, BenchPlan);
+  return BenchSpectrum.Magnitudes(Spectrum);
+}
+
+static void BenchPrepare(const float *Magnitude, uint32_t *DisplayData){
+  BenchSpectrum.PrepareBars(Magnitude, DisplayData);
+}
+
+static void BenchRender(uint32_t *DisplayData, int Bars, float MajorFreq){
+  PlotFFTBarGraph(*BenchDisplay, DisplayData, Bars, MajorFreq, 0, FFTPLOT_DEFAULT_COLOR);
+}
+
+static unsigned long BenchMicros(){
+  return micros();
+}
+
+static void BenchPrint(const char *Text){
+  BenchSerial->print(Text);
+}
+
+/*
+*   Function to run every synthetic source through the pipeline stages and print the result as JSON.
+*   The stages are the same calls the tasks make: ConvertSampledData(), ComputeFFT() with the
+*   magnitudes of InputSpectrum, its PrepareBars() and PlotFFTBarGraph(). The AUX input of a DUAL_CHANNEL build is converted
+*   as well, but only the main input goes through the FFT. The frames of the pool go round the queues of the benchmark.
+*   Has to run before the tasks are created, the frames and the FFT buffers are borrowed.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: TFT_eSPI &tft - The display, only used if there is no RAM for the sprite.
+*   Input: fft_config_t *FFT - The FFT of the pipeline.
+*   Input: fft_pruned_plan_t *Plan - The pruned FFT plan of the pipeline, can be NULL.
+*   Input: Frame *Pool - The FRAME_POOL_SIZE frames of the pipeline, none in use.
+*   Output: None.
+*/
+void RunPipelineBenchmark(Stream &Serial, TFT_eSPI &tft, fft_config_t *FFT, fft_pruned_plan_t *Plan, Frame *Pool){
+  int16_t *Raw = (int16_t *)malloc(BUFFER_SIZE * ADC_CHANNEL_COUNT * sizeof(int16_t));
+  if(Raw == NULL){
+    Serial.println("Pipeline benchmark: not enough memory");
+    return;
+  }
+  //The plot goes into a sprite, so the SPI transfer is not part of the render time.
+  TFT_eSprite Sprite = TFT_eSprite(&tft);
+  Sprite.setColorDepth(8);
+  bool UseSprite = Sprite.createSprite(BoxW, TEXT3_startY + TEXT3_HEIGHT) != NULL;
+  BenchSerial = &Serial;
+  BenchDisplay = UseSprite? (TFT_eSPI *)&Sprite : &tft;
+  BenchFFT = FFT;
+  BenchPlan = Plan;
+
+  PipelineStages S;
+  S.Size = BUFFER_SIZE;
+  S.SampleRate = ReadFreq;
+  S.Inputs = ADC_CHANNEL_COUNT;
+  S.Tag = ADC_CHANNEL_USED;
+  S.AuxTag = AUX_ADC_CHANNEL_USED;
+  S.Bars = InputSpectrum::Channels;
+  S.FreqStart = FFTPLOT_FREQ_START;
+  S.FreqEnd = FFTPLOT_FREQ_END;
+  S.Pruned = (Plan != NULL);
+  S.Display = UseSprite? "sprite" : "tft";
+  S.Convert = ConvertSampledData;
+  S.Transform = BenchTransform;
+  S.Prepare = BenchPrepare;
+  S.Render = BenchRender;
+  S.Micros = BenchMicros;
+  S.Allocations = NULL;
+  S.HeapBlocks = AllocatedBlocks;
+  S.Print = BenchPrint;
+  PipelineFrame Frames[FRAME_POOL_SIZE];
+  for(int i = 0; i < FRAME_POOL_SIZE; i++){
+    Frames[i].Samples = Pool[i].Samples;
+    Frames[i].SamplesAux = Pool[i].SamplesAux;
+    Frames[i].Spectrum = Pool[i].Spectrum;
+    Frames[i].DisplayData = Pool[i].DisplayData;
+  }
+  RunPipelineTiming(&S, Raw, Frames, FRAME_POOL_SIZE);
+
+  if(UseSprite){
+    Sprite.deleteSprite();
+  }
+  free(Raw);
+}
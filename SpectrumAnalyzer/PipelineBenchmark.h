@@ -0,0 +1,21 @@
+/*
+    * PipelineBenchmark.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the pipeline benchmark of the sketch. It hands
+    *  the stages of the sketch, from the raw i2s words to the bar graph, to
+    *  the timing loop of PipelineTiming.h, which prints the timings as JSON.
+    *  
+*/
+#ifndef _PIPELINEBENCHMARK_H
+#define _PIPELINEBENCHMARK_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "SignalSampler.h"
+#include "FramePipeline.h"
+#include "PipelineTiming.h"
+
+//Function Prototypes
+void RunPipelineBenchmark(Stream &Serial, TFT_eSPI &tft, fft_config_t *FFT, fft_pruned_plan_t *Plan, Frame *Pool);
+#endif //_PIPELINEBENCHMARK_H
@@ -0,0 +1,322 @@
+/*
+*   PipelineTiming.cpp
+*   Created on: Oct 19, 2026
+*   Runs the synthetic sources through the pipeline stages and reports the time spent in each.
+*   The i2s driver is replaced by GenerateRawSamples(), the stages are handed in, so the same loop
+*   times the sketch on the ESP32 and, with the main() at the end, the same stage code on a PC.
+*/
+#include "PipelineTiming.h"
+#include "SignalGenerator.h"
+#include <stdio.h>
+
+//Time spent in every stage, summed over the frames of one source
+struct BenchmarkTimes{
+  unsigned long Generate;
+  unsigned long Convert;
+  unsigned long FFT;
+  unsigned long Prepare;
+  unsigned long Render;
+  unsigned long FrameMax;                       //Slowest frame, Convert to Render
+};
+
+//Functions
+
+/*
+*   Function to run every synthetic source through the pipeline stages and print the result as JSON.
+*   The main input is made at Tag, with two inputs the AUX one is interleaved at AuxTag, the same way the ADC
+*   alternates between them. Only the main input goes through the FFT.
+*   The frames go round the queues free -> compute -> render -> free. Every turn the render stage goes first,
+*   then compute, then acquire, so each stage works on another frame, as the tasks do. One thread runs them, so the
+*   times add up, the fps are worked out: the busier of acquisition and processing (core 0) and rendering (core 1)
+*   sets the pace, and no more frames than captures (source_fps) can come out.
+*   Allocations are counted around the loop, allocs_per_frame is the number of allocator calls and
+*   net_blocks_per_frame the change of the blocks in use, which a malloc with its free does not show.
+*   Either one is null when the stages can not tell.
+*   Input: const PipelineStages *S - The pipeline.
+*   Input: int16_t *Raw - Room for Size * Inputs raw words.
+*   Input: PipelineFrame *Frames - The frames, 2 to PIPELINE_BENCH_POOL of them.
+*   Input: int FrameCount - Number of frames.
+*   Output: None.
+*/
+void RunPipelineTiming(const PipelineStages *S, int16_t *Raw, PipelineFrame *Frames, int FrameCount){
+  char Text[PIPELINE_BENCH_TEXT];
+  float SourceFps = S->SampleRate * 1.0 / S->Size;
+  FrameCount = (FrameCount > PIPELINE_BENCH_POOL)? PIPELINE_BENCH_POOL : FrameCount;
+  snprintf(Text, sizeof(Text), "{\"benchmark\":\"pipeline\",\"buffer_size\":%d,\"sample_rate\":%d,\"channels\":%d,\"pruned\":%s,\"display\":\"%s\",\"frames_in_flight\":%d,\"source_fps\":%.2f,\"sources\":[",
+           S->Size, S->SampleRate, S->Inputs, S->Pruned? "true" : "false", S->Display, FrameCount, SourceFps);
+  S->Print(Text);
+  for(int Type = 0; Type < SIGNAL_TYPE_COUNT; Type++){
+    SignalGenerator Source, AuxSource;
+    InitializeSignalGenerator(&Source, (SignalType)Type, S->SampleRate, (Type == SIGNAL_CHIRP)? S->FreqStart : PIPELINE_BENCH_FREQ, S->FreqEnd, PIPELINE_BENCH_AMPLITUDE);
+    InitializeSignalGenerator(&AuxSource, (SignalType)Type, S->SampleRate, 1.5 * PIPELINE_BENCH_FREQ, S->FreqEnd, PIPELINE_BENCH_AMPLITUDE);
+    BenchmarkTimes Times = {0, 0, 0, 0, 0, 0};
+    PipelineQueue FreeFrames, ComputeFrames, RenderFrames;
+    for(int i = 0; i < FrameCount; i++){
+      FreeFrames.Push(&Frames[i]);
+    }
+    int Acquired = 0, Rendered = 0, QueueMax = 0;
+    float MajorFreq = 0;
+    unsigned long CallsBefore = (S->Allocations != NULL)? S->Allocations() : 0;
+    long BlocksBefore = (S->HeapBlocks != NULL)? S->HeapBlocks() : 0;
+
+    while(Rendered < PIPELINE_BENCH_FRAMES){
+      PipelineFrame *F;
+      if(RenderFrames.Pop(F)){
+        unsigned long t0 = S->Micros();
+        S->Render(F->DisplayData, S->Bars, F->MajorFreq);
+        unsigned long t1 = S->Micros();
+        Times.Render += t1 - t0;
+        F->BusyUs += t1 - t0;
+        Times.FrameMax = (F->BusyUs > Times.FrameMax)? F->BusyUs : Times.FrameMax;
+        MajorFreq = F->MajorFreq;
+        FreeFrames.Push(F);
+        Rendered++;
+      }
+      if(ComputeFrames.Pop(F)){
+        unsigned long t0 = S->Micros();
+        F->MajorFreq = S->Transform(F->Samples, F->Spectrum);
+        unsigned long t1 = S->Micros();
+        S->Prepare(F->Spectrum, F->DisplayData);
+        unsigned long t2 = S->Micros();
+        Times.FFT += t1 - t0;
+        Times.Prepare += t2 - t1;
+        F->BusyUs += t2 - t0;
+        RenderFrames.Push(F);
+      }
+      if(Acquired < PIPELINE_BENCH_FRAMES && FreeFrames.Pop(F)){
+        unsigned long t0 = S->Micros();
+        GenerateRawSamples(&Source, Raw, S->Size, S->Inputs, S->Tag);
+        if(S->Inputs > 1){
+          GenerateRawSamples(&AuxSource, Raw + 1, S->Size, S->Inputs, S->AuxTag);
+        }
+        unsigned long t1 = S->Micros();
+        S->Convert(Raw, F->Samples, F->SamplesAux);
+        unsigned long t2 = S->Micros();
+        Times.Generate += t1 - t0;
+        Times.Convert += t2 - t1;
+        F->BusyUs = t2 - t1;
+        ComputeFrames.Push(F);
+        Acquired++;
+      }
+      int Waiting = ComputeFrames.Count() + RenderFrames.Count();
+      QueueMax = (Waiting > QueueMax)? Waiting : QueueMax;
+    }
+    float Frames = PIPELINE_BENCH_FRAMES;
+    char Calls[16] = "null", Blocks[16] = "null";
+    if(S->Allocations != NULL){
+      snprintf(Calls, sizeof(Calls), "%.2f", (S->Allocations() - CallsBefore) / Frames);
+    }
+    if(S->HeapBlocks != NULL){
+      snprintf(Blocks, sizeof(Blocks), "%.2f", (S->HeapBlocks() - BlocksBefore) / Frames);
+    }
+    float ConvertUs = Times.Convert / Frames, FFTUs = Times.FFT / Frames, PrepareUs = Times.Prepare / Frames, RenderUs = Times.Render / Frames;
+    float FrameUs = ConvertUs + FFTUs + PrepareUs + RenderUs;
+    //Acquisition and processing share core 0, rendering has core 1, the busier core sets the pace.
+    float Core0Us = ConvertUs + FFTUs + PrepareUs;
+    float StageFps = 1e6 / ((Core0Us > RenderUs)? Core0Us : RenderUs);
+
+    snprintf(Text, sizeof(Text), "%s{\"source\":\"%s\",\"frames\":%d,\"generate_us\":%.1f,\"convert_us\":%.1f,\"fft_us\":%.1f,\"prepare_us\":%.1f,\"render_us\":%.1f,"
+             "\"frame_us\":%.1f,\"frame_us_max\":%lu,\"queued_max\":%d,\"pipelined_fps\":%.1f,\"headroom\":%.1f,\"allocs_per_frame\":%s,\"net_blocks_per_frame\":%s,\"major_freq\":%.1f}",
+             (Type == 0)? "" : ",", SignalTypeName((SignalType)Type), PIPELINE_BENCH_FRAMES, Times.Generate / Frames, ConvertUs, FFTUs, PrepareUs, RenderUs,
+             FrameUs, Times.FrameMax, QueueMax, (StageFps < SourceFps)? StageFps : SourceFps, StageFps / SourceFps, Calls, Blocks, MajorFreq);
+    S->Print(Text);
+  }
+  S->Print("]}\n");
+}
+
+#ifndef ARDUINO
+//Host build: the conversion, FFT, spectrum and bar graph code of the sketch with its defines, a framebuffer in RAM as the display.
+#include "SampleStages.h"
+#include "BarGraph.h"
+#include <chrono>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+
+//Defines
+#define HOST_FONT_W 6                           //Cell of a character of the built-in font of TFT_eSPI(pixels)
+#define HOST_FONT_H 8
+#define HOST_BACKGROUND 0xFFFF                  //BG_Color(TFT_WHITE)
+#define HOST_PLOT_COLOR 0xFFFF                  //FFTPLOT_DEFAULT_COLOR(TFT_WHITE), what the benchmark of the sketch draws with
+
+/*
+*   Stand-in for the TFT_eSPI, the calls the bar graph makes on it draw into a framebuffer in RAM
+*   the size of the sprite PipelineBenchmark.cpp uses. Characters are drawn as a filled cell.
+*/
+class HostDisplay{
+  private:
+    uint16_t Pixels[TEXT3_startY + TEXT3_HEIGHT][BoxW];
+    int CursorX, CursorY;
+
+  public:
+    HostDisplay() : CursorX(0), CursorY(0) { memset(Pixels, 0xFF, sizeof(Pixels)); }
+
+    void fillRect(int x, int y, int w, int h, uint16_t Color){
+      int x1 = (x + w < BoxW)? x + w : BoxW, y1 = (y + h < TEXT3_startY + TEXT3_HEIGHT)? y + h : TEXT3_startY + TEXT3_HEIGHT;
+      for(int Row = (y > 0)? y : 0; Row < y1; Row++){
+        for(int Col = (x > 0)? x : 0; Col < x1; Col++){
+          Pixels[Row][Col] = Color;
+        }
+      }
+    }
+
+    void drawRect(int x, int y, int w, int h, uint16_t Color){
+      fillRect(x, y, w, 1, Color);
+      fillRect(x, y + h - 1, w, 1, Color);
+      fillRect(x, y, 1, h, Color);
+      fillRect(x + w - 1, y, 1, h, Color);
+    }
+
+    void fillTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t Color){
+      //Every pixel of the bounding box on the inner side of all three edges.
+      int Area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+      for(int y = (y0 < y1)? ((y0 < y2)? y0 : y2) : ((y1 < y2)? y1 : y2); y <= ((y0 > y1)? ((y0 > y2)? y0 : y2) : ((y1 > y2)? y1 : y2)); y++){
+        for(int x = (x0 < x1)? ((x0 < x2)? x0 : x2) : ((x1 < x2)? x1 : x2); x <= ((x0 > x1)? ((x0 > x2)? x0 : x2) : ((x1 > x2)? x1 : x2)); x++){
+          int e0 = (x1 - x0) * (y - y0) - (x - x0) * (y1 - y0);
+          int e1 = (x2 - x1) * (y - y1) - (x - x1) * (y2 - y1);
+          int e2 = (x0 - x2) * (y - y2) - (x - x2) * (y0 - y2);
+          if((Area >= 0)? (e0 >= 0 && e1 >= 0 && e2 >= 0) : (e0 <= 0 && e1 <= 0 && e2 <= 0)){
+            fillRect(x, y, 1, 1, Color);
+          }
+        }
+      }
+    }
+
+    void setCursor(int x, int y){
+      CursorX = x;
+      CursorY = y;
+    }
+
+    void print(const char *Text){
+      for(; *Text != '\0'; Text++, CursorX += HOST_FONT_W){
+        if(*Text != ' '){
+          fillRect(CursorX, CursorY, HOST_FONT_W - 1, HOST_FONT_H - 1, BAR_GRAPH_INK);
+        }
+      }
+    }
+
+    void print(int Value){
+      char Text[16];
+      snprintf(Text, sizeof(Text), "%d", Value);
+      print(Text);
+    }
+
+    void printf(const char *Format, ...){
+      char Text[32];
+      va_list Args;
+      va_start(Args, Format);
+      vsnprintf(Text, sizeof(Text), Format, Args);
+      va_end(Args);
+      print(Text);
+    }
+};
+
+static float Twiddle[2 * BUFFER_SIZE];
+static unsigned char Masks[BUFFER_SIZE];
+static fft_config_t FFT;
+static fft_pruned_plan_t Plan;
+static InputSpectrum Spectrum;
+static HostDisplay Display;
+static int MaxBarHeight;
+static unsigned long Allocations;
+
+#ifdef __GLIBC__
+//Counting allocator, every malloc, calloc and realloc of the process (new as well) goes through here.
+extern "C" void *__libc_malloc(size_t Size);
+extern "C" void *__libc_calloc(size_t Count, size_t Size);
+extern "C" void *__libc_realloc(void *Ptr, size_t Size);
+extern "C" void *malloc(size_t Size){
+  Allocations++;
+  return __libc_malloc(Size);
+}
+extern "C" void *calloc(size_t Count, size_t Size){
+  Allocations++;
+  return __libc_calloc(Count, Size);
+}
+extern "C" void *realloc(void *Ptr, size_t Size){
+  Allocations++;
+  return __libc_realloc(Ptr, Size);
+}
+
+static unsigned long CountedAllocations(){
+  return Allocations;
+}
+#endif
+
+/*
+*   Function to take the pruned real FFT and the magnitudes of the band, the way the compute task does.
+*   Input: float *Samples - BUFFER_SIZE samples.
+*   Input: float *Out - Set to the magnitudes.
+*   Output: float - The major frequency.
+*/
+static float HostTransform(float *Samples, float *Out){
+  FFT.input = Samples;
+  FFT.output = Out;
+  ComputeFFT(&FFT, &Plan);
+  return Spectrum.Magnitudes(Out);
+}
+
+static void HostPrepare(const float *Magnitude, uint32_t *DisplayData){
+  Spectrum.PrepareBars(Magnitude, DisplayData);
+}
+
+/*
+*   Function to draw the bars with the bar graph code of PlotFFTBarGraph() into the framebuffer.
+*   Input: uint32_t *DisplayData - The bars.
+*   Input: int Bars - Number of bars.
+*   Input: float MajorFreq - Printed under the plot.
+*   Output: None.
+*/
+static void HostRender(uint32_t *DisplayData, int Bars, float MajorFreq){
+  DrawBarGraph(Display, DisplayData, Bars, MajorFreq, 0, HOST_PLOT_COLOR, HOST_BACKGROUND, true, (const uint8_t *)NULL, 0, MaxBarHeight);
+}
+
+static unsigned long HostMicros(){
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void HostPrint(const char *Text){
+  fputs(Text, stdout);
+}
+
+int main(){
+  static int16_t Raw[BUFFER_SIZE * ADC_CHANNEL_COUNT];
+  static float Samples[PIPELINE_BENCH_POOL][BUFFER_SIZE], SamplesAux[PIPELINE_BENCH_POOL][BUFFER_SIZE], Out[BUFFER_SIZE];
+  static uint32_t DisplayData[PIPELINE_BENCH_POOL][FFTPLOT_CHANNEL];
+  PipelineFrame Frames[PIPELINE_BENCH_POOL];
+  for(int i = 0; i < PIPELINE_BENCH_POOL; i++){
+    Frames[i].Samples = Samples[i];
+    Frames[i].SamplesAux = SamplesAux[i];
+    Frames[i].Spectrum = Out;
+    Frames[i].DisplayData = DisplayData[i];
+  }
+  fft_init_static(&FFT, Twiddle, BUFFER_SIZE, FFT_REAL, FFT_FORWARD, Samples[0], Out);
+  rfft_pruned_init(&Plan, Masks, Twiddle, BUFFER_SIZE, InputSpectrum::BinStart, InputSpectrum::PlanEnd);
+
+  PipelineStages S;
+  S.Size = BUFFER_SIZE;
+  S.SampleRate = ReadFreq;
+  S.Inputs = ADC_CHANNEL_COUNT;
+  S.Tag = ADC_CHANNEL_TAG;
+  S.AuxTag = AUX_ADC_CHANNEL_TAG;
+  S.Bars = InputSpectrum::Channels;
+  S.FreqStart = FFTPLOT_FREQ_START;
+  S.FreqEnd = FFTPLOT_FREQ_END;
+  S.Pruned = true;
+  S.Display = "host";
+  S.Convert = ConvertSampledData;
+  S.Transform = HostTransform;
+  S.Prepare = HostPrepare;
+  S.Render = HostRender;
+  S.Micros = HostMicros;
+#ifdef __GLIBC__
+  S.Allocations = CountedAllocations;
+#else
+  S.Allocations = NULL;
+#endif
+  S.HeapBlocks = NULL;
+  S.Print = HostPrint;
+  RunPipelineTiming(&S, Raw, Frames, PIPELINE_BENCH_POOL);
+  return 0;
+}
+#endif
@@ -0,0 +1,64 @@
+/*
+    * PipelineTiming.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the timing loop of the pipeline benchmark. Every
+    *  synthetic source of SignalGenerator.h is made into raw i2s words and run
+    *  through the stages handed in, from the raw words to the render sink, and
+    *  the timings are printed as JSON. The frames go from stage to stage
+    *  through the queue of FrameQueue.h, the way the tasks of the sketch hand
+    *  them on. The stages are function pointers, the sketch hands in its own
+    *  (PipelineBenchmark.cpp). The host build hands in the same conversion,
+    *  FFT and bar graph code (SampleStages.h, BarGraph.h), drawn into a
+    *  framebuffer in RAM. Does not depend on the ESP32.
+    *  Build and run it on a PC (glibc counts the allocator calls):
+    *    g++ -O2 -Wall -Wextra -o pipelinetiming PipelineTiming.cpp SampleStages.cpp SignalGenerator.cpp PartialTracker.cpp PeakPicker.cpp && ./pipelinetiming
+    *
+*/
+#ifndef _PIPELINETIMING_H
+#define _PIPELINETIMING_H
+
+#include <stdint.h>
+#include "FrameQueue.h"
+
+//Defines
+#define PIPELINE_BENCH_FRAMES 50                //Frames run through the stages for every source
+#define PIPELINE_BENCH_FREQ 1000                //Frequency of the sine(Hz)
+#define PIPELINE_BENCH_AMPLITUDE 1500           //Peak amplitude of every source(ADC counts)
+#define PIPELINE_BENCH_TEXT 384                 //Longest line of the report
+#define PIPELINE_BENCH_POOL FRAME_POOL_SIZE     //Frames cycled through the queues, as many as the sketch has
+
+//The pipeline under test
+struct PipelineStages{
+  int Size;                                     //Samples of one capture
+  int SampleRate;                               //Hz
+  int Inputs;                                   //Inputs interleaved in the raw words, 1 or 2
+  int Tag, AuxTag;                              //ADC channels in the top bits of the raw words
+  int Bars;                                     //Bars of the FFT plot
+  float FreqStart, FreqEnd;                     //Band of the plot(Hz), the chirp sweeps it
+  bool Pruned;                                  //The FFT only computes the bins of the band
+  const char *Display;                          //Where Render draws to
+  double (*Convert)(const int16_t *Raw, float *Samples, float *SamplesAux);
+  float (*Transform)(float *Samples, float *Spectrum);                     //FFT and magnitudes, returns the major frequency
+  void (*Prepare)(const float *Magnitude, uint32_t *DisplayData);
+  void (*Render)(uint32_t *DisplayData, int Bars, float MajorFreq);
+  unsigned long (*Micros)();
+  unsigned long (*Allocations)();               //Calls to the allocator so far, NULL if they are not counted
+  long (*HeapBlocks)();                         //Heap blocks allocated right now, NULL if not known
+  void (*Print)(const char *Text);
+};
+
+//One frame of the benchmark, the buffers are handed in
+struct PipelineFrame{
+  float *Samples, *SamplesAux;                  //Size samples each, SamplesAux only with two inputs
+  float *Spectrum;                              //Size floats, the FFT output. Only used by the compute stage, so the frames can share it
+  uint32_t *DisplayData;                        //Bars bars
+  float MajorFreq;
+  unsigned long BusyUs;                         //Time spent on the frame, Convert to Render
+};
+
+typedef SPSCQueue<PIPELINE_BENCH_POOL, PipelineFrame> PipelineQueue;
+
+//Function Prototypes
+void RunPipelineTiming(const PipelineStages *S, int16_t *Raw, PipelineFrame *Frames, int FrameCount);
+#endif //_PIPELINETIMING_H
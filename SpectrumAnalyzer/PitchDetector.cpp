@@ -0,0 +1,167 @@
+/*
+*   PitchDetector.cpp
+*   Created on: Oct 19, 2026
+*   Autocorrelation pitch detector, YIN on top of a zero padded FFT correlation.
+*/
+#include "PitchDetector.h"
+#include "FFT.h"
+
+//Functions
+
+/*
+*   Function to set up the pitch detector.
+*   Input: PitchDetector *P - The detector.
+*   Input: float *Twiddles - Twiddle factors of a Size FFT (the main FFT has them).
+*   Input: float *Scratch - Size floats, only used while DetectPitch() runs.
+*   Input: int Size - FFT size.
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Output: None.
+*/
+void InitializePitchDetector(PitchDetector *P, float *Twiddles, float *Scratch, int Size, float SampleRate){
+  P->Twiddles = Twiddles;
+  P->Scratch = Scratch;
+  P->Size = Size;
+  P->SampleRate = SampleRate;
+  P->LagMin = (int)(SampleRate / PITCH_MAX_FREQ);
+  P->LagMax = (int)ceil(SampleRate / PITCH_MIN_FREQ);
+  P->LagMax = (P->LagMax > Size/2 - 2)? Size/2 - 2 : P->LagMax;
+  P->Window = Size - P->LagMax - 1;
+  P->Pitch = 0;
+  P->Confidence = 0;
+}
+
+/*
+*   Function to get the bottom of the parabola through three points of a curve, as a shift from the middle one.
+*   Input: float Left, Middle, Right - The curve at t - 1, t and t + 1.
+*   Output: float - Shift of the bottom from t, between -1 and 1 (0 if the points do not curve up).
+*/
+static float ParabolaShift(float Left, float Middle, float Right){
+  float Den = Left - 2 * Middle + Right;
+  float Shift = (Den > 0)? 0.5 * (Left - Right) / Den : 0;
+  return (Shift < -1)? -1 : ((Shift > 1)? 1 : Shift);
+}
+
+/*
+*   Function to refine a dip of the normalized difference between samples with a parabola.
+*   Input: const float *d - Normalized difference, d[t - 1] and d[t + 1] are read.
+*   Input: int t - Lag of the dip.
+*   Input: float *Value - Set to the bottom of the parabola, only if t is a dip.
+*   Output: bool - Whether t is a dip (no neighbour below it).
+*/
+static bool RefineDip(const float *d, int t, float *Value){
+  if(d[t] > d[t - 1] || d[t] > d[t + 1]){
+    return false;
+  }
+  *Value = d[t] - 0.25 * (d[t - 1] - d[t + 1]) * ParabolaShift(d[t - 1], d[t], d[t + 1]);
+  return true;
+}
+
+/*
+*   Function to find the fundamental of a frame.
+*   1. The first Window samples, zero padded to Size, are correlated with the frame by FFT: c(t) is the sum of
+*      x(n) x(n + t) over n < Window. The padding is at least LagMax + 1 long, so no lag wraps around the frame.
+*   2. The difference function of YIN is d(t) = e(0) + e(t) - 2c(t), e(t) the energy of the Window samples from t on.
+*      It is normalized by its running mean so it starts at 1 and dips towards 0 at every multiple of the period.
+*   3. Every dip is refined between samples with a parabola, the first one whose bottom is below PITCH_YIN_THRESHOLD
+*      is the period. Without one, the deepest dip if it is below PITCH_VOICED_LIMIT.
+*   4. Octave check: a dip at a whole fraction of that period (the shortest one first) that is nearly as deep is the period instead.
+*   SelfTest.cpp sweeps sine and sawtooth notes from A2 to B5 through it.
+*   Input: PitchDetector *P - The detector, Pitch and Confidence are updated.
+*   Input: const float *Samples - Size samples of the frame, not changed.
+*   Input: float Average - Average of the samples, the DC that is taken out.
+*   Input: float *Spectrum - Size floats of work space (the FFT output of the frame), holds garbage afterwards.
+*   Output: float - The fundamental(Hz), 0 if the frame has none (noise or silence).
+*/
+float DetectPitch(PitchDetector *P, const float *Samples, float Average, float *Spectrum){
+  int N = P->Size;
+  int W = P->Window;
+  float *c = P->Scratch;
+  //1. Spectrum of the zero padded start into Spectrum, of the whole frame into the scratch, their cross power back into Spectrum.
+  for(int n = 0; n < N; n++){
+    c[n] = (n < W)? Samples[n] - Average : 0;
+  }
+  rfft(c, Spectrum, P->Twiddles, N);
+  rfft((float *)Samples, c, P->Twiddles, N);   //Out of place, the samples are only read
+  c[0] -= N * Average;                         //The DC of the frame is the only bin the average changes
+  Spectrum[0] *= c[0];
+  Spectrum[1] *= c[1];
+  for(int k = 2; k < N; k += 2){
+    float Re = Spectrum[k] * c[k] + Spectrum[k+1] * c[k+1];
+    float Im = Spectrum[k] * c[k+1] - Spectrum[k+1] * c[k];
+    Spectrum[k] = Re;
+    Spectrum[k+1] = Im;
+  }
+  irfft(Spectrum, c, P->Twiddles, N);
+
+  P->Pitch = 0;
+  P->Confidence = 0;
+  float e0 = 0;
+  for(int n = 0; n < W; n++){
+    e0 += (Samples[n] - Average) * (Samples[n] - Average);
+  }
+  if(e0 <= 0){
+    return 0;                                   //Silence
+  }
+  //2. Cumulative mean normalized difference, written over the correlation as it is used. The plain one goes to Spectrum.
+  float *Raw = Spectrum;
+  float e = e0;
+  float Sum = 0;
+  c[0] = 1;
+  Raw[0] = 0;
+  for(int t = 1; t <= P->LagMax + 1; t++){
+    float Leaving = Samples[t - 1] - Average, Entering = Samples[t - 1 + W] - Average;
+    e += Entering * Entering - Leaving * Leaving;
+    float d = e0 + e - 2 * c[t];
+    d = (d > 0)? d : 0;
+    Raw[t] = d;
+    Sum += d;
+    c[t] = (Sum > 0)? d * t / Sum : 1;
+  }
+  //3. First dip below the threshold, else the deepest one.
+  int Lag = 0;
+  float Value = 1;
+  int DeepestLag = 0;
+  float Deepest = 1;
+  for(int t = P->LagMin; t <= P->LagMax; t++){
+    float DipValue;
+    if(!RefineDip(c, t, &DipValue)){
+      continue;
+    }
+    if(DipValue < PITCH_YIN_THRESHOLD){
+      Lag = t;
+      Value = DipValue;
+      break;
+    }
+    if(DipValue < Deepest){
+      DeepestLag = t;
+      Deepest = DipValue;
+    }
+  }
+  if(Lag == 0){
+    if(Deepest >= PITCH_VOICED_LIMIT){
+      return 0;                                 //Nothing periodic, noise
+    }
+    Lag = DeepestLag;
+    Value = Deepest;
+  }
+  //4. The shortest whole fraction of the period with a dip about as deep.
+  for(int Fraction = Lag / P->LagMin; Fraction >= 2; Fraction--){
+    int Center = (int)((float)Lag / Fraction + 0.5);
+    int Best = 0;
+    for(int t = Center - 1; t <= Center + 1; t++){
+      if(t >= P->LagMin && t <= P->LagMax && (Best == 0 || c[t] < c[Best])){
+        Best = t;
+      }
+    }
+    float DipValue;
+    if(Best != 0 && RefineDip(c, Best, &DipValue) && DipValue <= Value + PITCH_OCTAVE_MARGIN){
+      Lag = Best;
+      Value = DipValue;
+      break;
+    }
+  }
+  //The bottom between samples from the plain difference, the normalization bends the dip.
+  P->Pitch = P->SampleRate / (Lag + ParabolaShift(Raw[Lag - 1], Raw[Lag], Raw[Lag + 1]));
+  P->Confidence = (Value < 1)? 1 - Value : 0;
+  return P->Pitch;
+}
@@ -0,0 +1,37 @@
+/*
+    * PitchDetector.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the pitch detector. The correlation of the frame
+    *  with its start is taken with FFTs (two rfft and one irfft of the main FFT
+    *  size instead of an O(N^2) sum), the end of the start is zero padded so no
+    *  lag wraps around the frame, and the fundamental is picked from it the way YIN does.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _PITCHDETECTOR_H
+#define _PITCHDETECTOR_H
+
+//Defines
+#define PITCH_MIN_FREQ 50                       //Lowest fundamental searched for(Hz)
+#define PITCH_MAX_FREQ 1000                     //Highest fundamental searched for(Hz)
+#define PITCH_YIN_THRESHOLD 0.15                //The first dip of the normalized difference below this is the period
+#define PITCH_VOICED_LIMIT 0.35                 //Without such a dip the deepest one is used, if it is below this
+#define PITCH_OCTAVE_MARGIN 0.1                 //A dip at a whole fraction of the period replaces it if it is no more than this above it
+
+struct PitchDetector{
+  float *Twiddles;                              //Twiddle factors of a Size FFT, shared with the main FFT
+  float *Scratch;                               //Size floats, the zero padded frame and then the normalized difference
+  int Size;                                     //FFT size
+  float SampleRate;
+  int LagMin;                                   //Periods searched, in samples
+  int LagMax;
+  int Window;                                   //Samples compared at every lag, Window + LagMax + 1 fit in the frame
+  float Pitch;                                  //Fundamental of the last frame(Hz), 0 if there was none
+  float Confidence;                             //1 - normalized difference at the period, 0 to 1
+};
+
+//Function Prototypes
+void  InitializePitchDetector(PitchDetector *P, float *Twiddles, float *Scratch, int Size, float SampleRate);
+float DetectPitch(PitchDetector *P, const float *Samples, float Average, float *Spectrum);
+#endif //_PITCHDETECTOR_H
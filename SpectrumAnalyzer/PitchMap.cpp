@@ -0,0 +1,127 @@
+/*
+*   PitchMap.cpp
+*   Created on: Oct 19, 2026
+*   Sparse bin to note map for the chroma and piano plots.
+*/
+#include "PitchMap.h"
+#include <math.h>
+#include <stdio.h>
+
+static const char *NoteNames[PITCH_CLASSES] = {"C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"};
+
+//Functions
+
+/*
+*   Function to get the number of entries a map over a range of bins can have.
+*   Input: int BinStart, BinEnd - Range of bins.
+*   Output: int - Entries, two per bin.
+*/
+int PitchMapMaxEntries(int BinStart, int BinEnd){
+  return 2 * (BinEnd - BinStart + 1);
+}
+
+/*
+*   Function to get the (fractional) MIDI note number of a frequency, 69 is A4.
+*   Input: float Freq - The frequency(Hz).
+*   Output: float - The note number.
+*/
+float FrequencyToMidi(float Freq){
+  return 69.0 + 12.0 * log2(Freq / PITCH_A4_FREQ);
+}
+
+/*
+*   Function to get the name of a note, e.g. "A" or "A4".
+*   Input: int Midi - The MIDI note number.
+*   Input: bool Octave - Add the octave number.
+*   Input: char *Name - Set to the name, at least 5 characters.
+*   Output: None.
+*/
+void MidiNoteName(int Midi, bool Octave, char *Name){
+  if(Octave){
+    sprintf(Name, "%s%d", NoteNames[Midi % PITCH_CLASSES], Midi / PITCH_CLASSES - 1);
+  }
+  else{
+    sprintf(Name, "%s", NoteNames[Midi % PITCH_CLASSES]);
+  }
+}
+
+/*
+*   Function to work out which notes every bin feeds.
+*   A bin between two notes is shared by the two, in proportion to how close it is to each.
+*   The notes at the bottom of the range get fewer bins than the ones at the top, the gains
+*   even that out so every bar is scaled as if it covered PITCH_BAR_BINS bins. A note with less
+*   than one bin is not boosted further, that would only blow up the noise.
+*   Input: PitchMap *Map - The map to fill in.
+*   Input: PitchMapEntry *Entries - Memory for PitchMapMaxEntries(BinStart, BinEnd) entries.
+*   Input: int BinStart, BinEnd - Range of bins to map, BinStart > 0.
+*   Input: float SampleRate - Sampling frequency(Hz).
+*   Input: int Size - FFT size.
+*   Output: PitchMap * - The map.
+*/
+PitchMap *InitializePitchMap(PitchMap *Map, PitchMapEntry *Entries, int BinStart, int BinEnd, float SampleRate, int Size){
+  float BinHz = SampleRate / Size;
+  Map->Entries = Entries;
+  Map->Count = 0;
+  Map->LowestMidi = lround(FrequencyToMidi(BinStart * BinHz));
+  Map->Keys = lround(FrequencyToMidi(BinEnd * BinHz)) - Map->LowestMidi + 1;
+  if(Map->Keys > PITCH_MAX_KEYS){
+    Map->Keys = PITCH_MAX_KEYS;
+  }
+
+  float ChromaWeight[PITCH_CLASSES] = {0};
+  float KeyWeight[PITCH_MAX_KEYS] = {0};
+  for(int Bin = BinStart; Bin <= BinEnd; Bin++){
+    float Midi = FrequencyToMidi(Bin * BinHz);
+    int Lower = floor(Midi);
+    float Frac = Midi - Lower;
+    for(int n = 0; n < 2; n++){
+      int Note = Lower + n;
+      float Weight = (n == 0)? 1.0 - Frac : Frac;
+      if(Weight <= 0){
+        continue;
+      }
+      int Key = Note - Map->LowestMidi;
+      PitchMapEntry &e = Entries[Map->Count++];
+      e.Bin = Bin;
+      e.Chroma = Note % PITCH_CLASSES;
+      e.Key = (Key >= 0 && Key < Map->Keys)? Key : PITCH_NO_KEY;
+      e.Weight = Weight;
+      ChromaWeight[e.Chroma] += Weight;
+      if(e.Key != PITCH_NO_KEY){
+        KeyWeight[e.Key] += Weight;
+      }
+    }
+  }
+  for(int i = 0; i < PITCH_CLASSES; i++){
+    Map->ChromaGain[i] = PITCH_BAR_BINS / fmax(ChromaWeight[i], 1.0);
+  }
+  for(int i = 0; i < PITCH_MAX_KEYS; i++){
+    Map->KeyGain[i] = PITCH_BAR_BINS / fmax(KeyWeight[i], 1.0);
+  }
+  return Map;
+}
+
+/*
+*   Function to fold the magnitudes of a frame into note bars.
+*   Input: const PitchMap *Map - The map.
+*   Input: const float *Magnitude - Magnitude of every bin, indexed by bin (Spectrum after SpectrumPipeline::Magnitudes()).
+*   Input: bool Chroma - True for the 12 pitch classes, false for the piano keys.
+*   Input: uint32_t *Bars - Set to the height of every bar, in the same units as SpectrumPipeline::PrepareBars().
+*   Output: int - Number of bars.
+*/
+int ApplyPitchMap(const PitchMap *Map, const float *Magnitude, bool Chroma, uint32_t *Bars){
+  float Sum[PITCH_MAX_KEYS] = {0};
+  int Count = Chroma? PITCH_CLASSES : Map->Keys;
+  const float *Gain = Chroma? Map->ChromaGain : Map->KeyGain;
+  for(int i = 0; i < Map->Count; i++){
+    const PitchMapEntry &e = Map->Entries[i];
+    int Bar = Chroma? e.Chroma : e.Key;
+    if(Bar != PITCH_NO_KEY){
+      Sum[Bar] += e.Weight * Magnitude[e.Bin];
+    }
+  }
+  for(int i = 0; i < Count; i++){
+    Bars[i] = Sum[i] * Gain[i];
+  }
+  return Count;
+}
@@ -0,0 +1,46 @@
+/*
+    * PitchMap.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the map from FFT bins to musical notes, used by the
+    *  chroma and piano plots. The map is worked out once when the plan is made,
+    *  so a frame only needs a multiply and add per entry and no log2 per bin.
+    *  Does not depend on the ESP32.
+    *  
+*/
+#ifndef _PITCHMAP_H
+#define _PITCHMAP_H
+
+#include <stdint.h>
+
+//Defines
+#define PITCH_A4_FREQ 440.0                     //Tuning of A4(Hz)
+#define PITCH_CLASSES 12                        //Notes in an octave, the bars of the chroma plot
+#define PITCH_MAX_KEYS 80                       //Most piano keys that are plotted, must not be more than FFTPLOT_CHANNEL
+#define PITCH_BAR_BINS 5                        //Every note bar is scaled as if it covered this many bins (about what an FFT bar covers)
+#define PITCH_NO_KEY 0xFF                       //Key of an entry whose note is outside the piano range
+
+//One bin feeding one note
+struct PitchMapEntry{
+  uint16_t Bin;
+  uint8_t Key;                                  //Piano key, counted from PitchMap.LowestMidi, or PITCH_NO_KEY
+  uint8_t Chroma;                               //Pitch class, 0 is C
+  float Weight;                                 //Share of the bin that goes to the note
+};
+
+struct PitchMap{
+  PitchMapEntry *Entries;                       //Two per bin, one for each of the notes it lies between
+  int Count;                                    //Entries in use
+  int LowestMidi;                               //MIDI number of the first piano key
+  int Keys;                                     //Piano keys covered by the bins
+  float ChromaGain[PITCH_CLASSES];              //Evens out how many bins each note gets
+  float KeyGain[PITCH_MAX_KEYS];
+};
+
+//Function Prototypes
+int   PitchMapMaxEntries(int BinStart, int BinEnd);
+PitchMap *InitializePitchMap(PitchMap *Map, PitchMapEntry *Entries, int BinStart, int BinEnd, float SampleRate, int Size);
+int   ApplyPitchMap(const PitchMap *Map, const float *Magnitude, bool Chroma, uint32_t *Bars);
+float FrequencyToMidi(float Freq);
+void  MidiNoteName(int Midi, bool Octave, char *Name);
+#endif //_PITCHMAP_H
@@ -0,0 +1,80 @@
+/*
+    * PlotScale.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds where the plots go on the screen and how values
+    *  become pixels on them: the height of a bar from its display data and
+    *  the row of a waveform point from its sample. The drawing code and the
+    *  power governor both use it, so what the governor compares is what ends
+    *  up on the screen.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _PLOTSCALE_H
+#define _PLOTSCALE_H
+
+#include <stdint.h>
+
+//Defines
+#define startX 0                                        //Start X coordinate for display box
+#define startY 0                                        //Start Y coordinate for display box
+#define BoxW 160                                        //Width of display box
+#define BoxH 100                                        //Height of display box
+#define TEXT_startX 0                                   //Start X coordinate for text              
+#define TEXT_startY 105                                 //Start Y coordinate for text
+#define TEXT_WIDTH 20                                   //Width of text box    
+#define TEXT_HEIGHT 10                                  //Height of text box
+//These are parameters for the other text that will
+//printed on the display
+#define TEXT2_startX 120
+#define TEXT2_startY 105
+#define TEXT2_WIDTH 40
+#define TEXT2_HEIGHT 10 
+#define TEXT3_startX 0
+#define TEXT3_startY 116
+#define TEXT3_WIDTH 80
+#define TEXT3_HEIGHT 10
+#define UpperYcut 2700                                  //Upper cutoff for plotting the sampled data
+#define LowerYcut 000                                   //Lower cutoff for plotting the sampled data
+#define FFTPLOT_CHANNEL 80                              //The channels on the FFF plot
+#define FFTPLOT_FREQ_START 50                          //The starting frequency for the FFT plot
+#define FFTPLOT_FREQ_END 4500                          //The ending frequency for the FFT plot
+#define FFTPLOT_THRESHOLD_LOWER 0
+#define FFTPLOT_THRESHOLD_UPPER 80000
+#define PEAK_MARKER_SIZE 4                              //Height of a marker(pixels)
+
+/*
+*   Function to map a value from one range to another, in whole numbers like map() of arduino.
+*   Input: long x - The value.
+*   Input: long InMin, InMax - Its range.
+*   Input: long OutMin, OutMax - The range to map to.
+*   Output: long - The mapped value, not clipped.
+*/
+inline long PlotMap(long x, long InMin, long InMax, long OutMin, long OutMax){
+  return (x - InMin) * (OutMax - OutMin) / (InMax - InMin) + OutMin;
+}
+
+/*
+*   Function to get the height of a bar of the FFT plot.
+*   Input: uint32_t Value - The display data of the bar.
+*   Output: uint16_t - Height(pixels), 0 to BoxH.
+*/
+inline uint16_t BarHeightOf(uint32_t Value){
+  if(Value > FFTPLOT_THRESHOLD_UPPER){
+    return BoxH;
+  }
+  if(Value <= FFTPLOT_THRESHOLD_LOWER){
+    return 0;
+  }
+  return PlotMap(Value, FFTPLOT_THRESHOLD_LOWER, FFTPLOT_THRESHOLD_UPPER, 0, BoxH);
+}
+
+/*
+*   Function to get the row of a point of the waveform plot, from the top of the box.
+*   Input: float Value - The sample.
+*   Output: int - Row(pixels), BoxH for LowerYcut and 0 for UpperYcut, outside the box beyond them.
+*/
+inline int WaveformRowOf(float Value){
+  return PlotMap(Value, LowerYcut, UpperYcut, BoxH, 0);
+}
+#endif //_PLOTSCALE_H
@@ -0,0 +1,182 @@
+/*
+*   PowerGovernor.cpp
+*   Created on: Oct 19, 2026
+*   Picks the power level from the signal activity and the load, and applies it on the ESP32.
+*/
+#include "PowerGovernor.h"
+#include <string.h>
+#include <math.h>
+#if defined(ARDUINO) && CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+//Functions
+
+/*
+*   Function to set up the governor at full power.
+*   Input: PowerGovernor *G - The governor.
+*   Input: unsigned long Now - Current time(us).
+*   Output: None.
+*/
+void InitializePowerGovernor(PowerGovernor *G, unsigned long Now){
+  memset(G, 0, sizeof(PowerGovernor));
+  G->QuietSince = Now;
+  G->HoldUntil = Now;
+  G->LastUpdate = Now;
+  G->Level = POWER_FULL;
+}
+
+/*
+*   Function to get the RMS of the samples around their average.
+*   Input: const float *Samples - The samples.
+*   Input: int Count - Number of samples.
+*   Input: float Average - Average of the samples (the ADC mid scale).
+*   Output: float - The RMS(ADC counts).
+*/
+float SignalRms(const float *Samples, int Count, float Average){
+  float Sum = 0;
+  for(int i = 0; i < Count; i++){
+    float x = Samples[i] - Average;
+    Sum += x * x;
+  }
+  return (Count > 0)? sqrt(Sum / Count) : 0.0;
+}
+
+/*
+*   Function to pick the power level of a frame, called before the frame is computed so
+*   a frame with activity is computed at full power.
+*   1. Activity (the RMS above POWER_RMS_FLOOR, or a wake up such as a button press) goes to POWER_FULL at once.
+*   2. After POWER_QUIET_DELAY_US of silence the level drops to POWER_QUIET, after POWER_IDLE_DELAY_US to POWER_IDLE.
+*   3. If the last frame took more than POWER_MAX_LOAD of the capture period, the level goes up by one
+*      and stays there for POWER_LOAD_HOLD_US, so a lower clock never makes the compute stage drop frames.
+*   Input: PowerGovernor *G - The governor.
+*   Input: unsigned long Now - Current time(us).
+*   Input: float Rms - RMS of the samples of the frame, from SignalRms().
+*   Input: bool Wake - Go to full power whatever the signal is.
+*   Input: unsigned long BusyUs - Time the compute stage spent on the last frame.
+*   Input: unsigned long PeriodUs - Time between two captures.
+*   Output: uint8_t - The PowerLevel of the frame.
+*/
+uint8_t UpdatePowerGovernor(PowerGovernor *G, unsigned long Now, float Rms, bool Wake, unsigned long BusyUs, unsigned long PeriodUs){
+  G->Frames++;
+  G->TimeAtLevel[G->Level] += (Now - G->LastUpdate) / 1000;
+  G->LastUpdate = Now;
+  G->Load = (PeriodUs > 0)? (float)BusyUs / PeriodUs : 0.0;
+
+  uint8_t Level = G->Level;
+  if(Wake || Rms > POWER_RMS_FLOOR){
+    G->QuietSince = Now;
+    Level = POWER_FULL;
+  }
+  else if(G->Level > POWER_FULL && G->Load > POWER_MAX_LOAD){
+    Level = G->Level - 1;
+    G->HoldUntil = Now + POWER_LOAD_HOLD_US;
+  }
+  else if((long)(Now - G->HoldUntil) >= 0){
+    unsigned long Quiet = Now - G->QuietSince;
+    Level = (Quiet >= POWER_IDLE_DELAY_US)? POWER_IDLE : ((Quiet >= POWER_QUIET_DELAY_US)? POWER_QUIET : POWER_FULL);
+    Level = (Level > G->Level + 1)? G->Level + 1 : Level;       //Down one level per frame, so the load is seen at each
+  }
+  if(Level != G->Level){
+    G->LevelChanges++;
+    G->Level = Level;
+  }
+  return G->Level;
+}
+
+/*
+*   Function to find out if a frame does not have to be computed at all: a silent frame at POWER_IDLE.
+*   Input: PowerGovernor *G - The governor.
+*   Input: float Rms - RMS of the samples of the frame.
+*   Output: bool - True if the FFT and everything after it can be skipped.
+*/
+bool PowerSkipCompute(PowerGovernor *G, float Rms){
+  bool Skip = (G->Level == POWER_IDLE) && (Rms <= POWER_RMS_FLOOR);
+  G->SkippedComputes += Skip;
+  return Skip;
+}
+
+/*
+*   Function to find out if drawing a frame is redundant: below full power and nothing on the plot moved by more
+*   than POWER_PIXEL_TOLERANCE. The bars and the waveform points are compared in pixels, through the same
+*   BarHeightOf() and WaveformRowOf() the plots draw with. Only a frame that is drawn replaces the kept pixels,
+*   so a plot creeping a pixel per frame is still redrawn once it has moved far enough.
+*   Input: PowerGovernor *G - The governor.
+*   Input: const uint32_t *Bars - Display data of the bars, NULL for the waveform plot.
+*   Input: const float *Samples - The waveform from its first drawn sample, only used when Bars is NULL.
+*   Input: int Count - Number of bars, or waveform points.
+*   Input: int Stride - Samples between two waveform points.
+*   Output: bool - True if the frame does not have to be drawn.
+*/
+bool PowerSkipRender(PowerGovernor *G, const uint32_t *Bars, const float *Samples, int Count, int Stride){
+  uint16_t Pixels[POWER_MAX_POINTS];
+  bool Waveform = (Bars == NULL);
+  Count = (Count > POWER_MAX_POINTS)? POWER_MAX_POINTS : Count;
+  for(int i = 0; i < Count; i++){
+    if(Waveform){
+      int Row = WaveformRowOf(Samples[i * Stride]);
+      Pixels[i] = (Row < 0)? 0 : ((Row > BoxH)? BoxH : Row);     //Points outside the box are not drawn
+    }
+    else{
+      Pixels[i] = BarHeightOf(Bars[i]);
+    }
+  }
+  bool Same = (Count == G->LastPixelCount) && (Waveform == G->LastWaveform);
+  for(int i = 0; i < Count && Same; i++){
+    int d = Pixels[i] - G->LastPixels[i];
+    Same = (d <= POWER_PIXEL_TOLERANCE && d >= -POWER_PIXEL_TOLERANCE);
+  }
+  bool Skip = Same && (G->Level != POWER_FULL);
+  if(!Skip){
+    memcpy(G->LastPixels, Pixels, Count * sizeof(uint16_t));
+    G->LastPixelCount = Count;
+    G->LastWaveform = Waveform;
+  }
+  G->SkippedRenders += Skip;
+  return Skip;
+}
+
+/*
+*   Function to get the CPU clock of a power level.
+*   Input: uint8_t Level - The PowerLevel.
+*   Output: uint32_t - The clock(MHz). 80 MHz is the lowest that keeps the APB, and so the i2s and SPI clocks, unchanged.
+*/
+uint32_t PowerLevelMhz(uint8_t Level){
+  static const uint32_t Mhz[POWER_LEVEL_COUNT] = {240, 160, 80};
+  return (Level < POWER_LEVEL_COUNT)? Mhz[Level] : 240;
+}
+
+#ifdef ARDUINO
+/*
+*   Function to put the ESP32 in a power level.
+*   With power management in the build (CONFIG_PM_ENABLE) the clock range and automatic light sleep are handed to
+*   esp_pm, which sleeps whenever every task waits and no driver holds a lock. Otherwise the clock is set directly,
+*   and between DMA frames the idle task halts the cores until the next interrupt.
+*   Input: uint8_t Level - The PowerLevel.
+*   Output: None.
+*/
+void ApplyPowerLevel(uint8_t Level){
+#if CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t Config;
+  Config.max_freq_mhz = PowerLevelMhz(Level);
+  Config.min_freq_mhz = PowerLevelMhz(POWER_IDLE);
+  Config.light_sleep_enable = (Level == POWER_IDLE);
+  esp_pm_configure(&Config);
+#else
+  setCpuFrequencyMhz(PowerLevelMhz(Level));
+#endif
+}
+
+/*
+*   Function to print the counters of the governor to the Serial object.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: const PowerGovernor *G - The governor.
+*   Output: None.
+*/
+void PrintPowerGovernorStats(Stream &Serial, const PowerGovernor *G){
+  Serial.println("----Power Governor Stats----");
+  Serial.printf("Level %d (%u MHz), load %.2f, level changes %lu\n", G->Level, (unsigned)PowerLevelMhz(G->Level), G->Load, G->LevelChanges);
+  Serial.printf("Frames %lu, computes skipped %lu, renders skipped %lu\n", G->Frames, G->SkippedComputes, G->SkippedRenders);
+  Serial.printf("Time at 240/160/80 MHz: %lu/%lu/%lu ms\n", G->TimeAtLevel[POWER_FULL], G->TimeAtLevel[POWER_QUIET], G->TimeAtLevel[POWER_IDLE]);
+}
+#endif
@@ -0,0 +1,67 @@
+/*
+    * PowerGovernor.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the power governor. From the level of the signal,
+    *  how much the plot changes and the measured load of the compute stage it
+    *  picks a power level: the CPU clock, whether a frame that would redraw the
+    *  same plot is drawn at all, and whether silent frames are computed.
+    *  Any activity brings back full power on the frame it shows up in.
+    *  The logic gets the time passed in and does not depend on the ESP32.
+    *
+*/
+#ifndef _POWERGOVERNOR_H
+#define _POWERGOVERNOR_H
+
+#include <stdint.h>
+#include "PlotScale.h"
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+//Defines
+#define POWER_GOVERNOR 1                        //Setting this to 0 keeps the device at full power
+#define POWER_RMS_FLOOR 6.0                     //RMS of the samples(ADC counts) below which the input is silent, about what FFT_NOISE_THRESHOLD lets through
+#define POWER_PIXEL_TOLERANCE 1                 //A plot whose bars or waveform points all moved by at most this(pixels) is not redrawn below full power
+#define POWER_QUIET_DELAY_US 1000000            //Silence before the clock is lowered
+#define POWER_IDLE_DELAY_US 5000000             //Silence before the lowest level
+#define POWER_MAX_LOAD 0.7                      //Share of the capture period the compute stage may take at a lower clock
+#define POWER_LOAD_HOLD_US 10000000             //After the load forced a higher clock, it is not lowered again for this long
+#define POWER_MAX_POINTS 160                    //Bars or waveform points the governor compares from frame to frame, one per column of the plot
+
+//Power levels, from full to the lowest
+enum PowerLevel{
+  POWER_FULL,                                   //240 MHz, every frame computed and drawn
+  POWER_QUIET,                                  //160 MHz, frames that draw the same plot are skipped
+  POWER_IDLE,                                   //80 MHz, silent frames are neither computed nor drawn, light sleep allowed
+  POWER_LEVEL_COUNT
+};
+
+struct PowerGovernor{
+  unsigned long QuietSince;                     //Time of the last frame with activity
+  unsigned long HoldUntil;                      //No lower level before this, set when the load was too high
+  unsigned long LastUpdate;
+  uint8_t Level;                                //The current PowerLevel
+  float Load;                                   //Compute time of the last frame over the capture period
+  uint16_t LastPixels[POWER_MAX_POINTS];        //Bar heights or waveform rows(pixels) of the last frame that was drawn
+  int LastPixelCount;
+  bool LastWaveform;                            //The last frame drawn was a waveform
+  unsigned long Frames;
+  unsigned long SkippedComputes;                //Silent frames that were not computed
+  unsigned long SkippedRenders;                 //Frames that were not drawn as the plot had not changed
+  unsigned long LevelChanges;
+  unsigned long TimeAtLevel[POWER_LEVEL_COUNT]; //Time spent at every level(ms)
+};
+
+//Function Prototypes
+void     InitializePowerGovernor(PowerGovernor *G, unsigned long Now);
+float    SignalRms(const float *Samples, int Count, float Average);
+uint8_t  UpdatePowerGovernor(PowerGovernor *G, unsigned long Now, float Rms, bool Wake, unsigned long BusyUs, unsigned long PeriodUs);
+bool     PowerSkipCompute(PowerGovernor *G, float Rms);
+bool     PowerSkipRender(PowerGovernor *G, const uint32_t *Bars, const float *Samples, int Count, int Stride);
+uint32_t PowerLevelMhz(uint8_t Level);
+#ifdef ARDUINO
+void     ApplyPowerLevel(uint8_t Level);
+void     PrintPowerGovernorStats(Stream &Serial, const PowerGovernor *G);
+#endif
+#endif //_POWERGOVERNOR_H
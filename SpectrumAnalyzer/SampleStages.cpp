@@ -0,0 +1,82 @@
+/*
+*   SampleStages.cpp
+*   Created on: Oct 19, 2026
+*   Conversion of the raw i2s words and the FFT of the sampled data, the part of the sampler that runs anywhere.
+*/
+#include "SampleStages.h"
+
+//Functions
+
+/*
+*   Function to convert raw i2s words into sample values.
+*   With DUAL_CHANNEL the ADC alternates between the two inputs. The upper 4 bits of every i2s word
+*   are the ADC channel the sample came from, which is used to split them.
+*   Input: const int16_t* Raw - BUFFER_SIZE * ADC_CHANNEL_COUNT words as read from the i2s driver (or made by SignalGenerator).
+*   Input: double* AnalogValue_re - Reference to the array to store the sampled data.
+*   Input: double* AuxValue_re - Reference to the array to store the sampled data of the AUX input (only with DUAL_CHANNEL).
+*   Return: Average of the sampled data.
+*/
+double ConvertSampledData(const int16_t* Raw, float* AnalogValue_re, float* AuxValue_re){
+    double avg = 0; 
+    if(!DUAL_CHANNEL){
+      //Now copy the data into the output data array
+      for(int i = 0; i < BUFFER_SIZE; i++){
+          int16_t value = ADC_CHANNEL_TAG * 0x1000 + 0xFFF - Raw[i];   //Some Voodoo magic to get the correct value, I think it to convert the output format of i2s. Found online.
+          AnalogValue_re[i] = 4096.0 - value;                                 //The value needs to be substracted from 4096 to get the correct value. (i.e the one read from AnalogRead())
+          avg += AnalogValue_re[i];
+      }
+    }
+    else{
+      //Split the samples by their channel tag. Right after the pattern table is changed a few
+      //samples can be off, so each channel is capped at BUFFER_SIZE and padded with its last value.
+      int CountA = 0;
+      int CountB = 0;
+      for(int i = 0; i < BUFFER_SIZE * ADC_CHANNEL_COUNT; i++){
+          int Tag = (Raw[i] >> 12) & 0x0F;
+          float Value = 4096.0 - (Tag * 0x1000 + 0xFFF - Raw[i]);             //Same conversion as above, with the tag of the sample
+          if((Tag == ADC_CHANNEL_TAG) && (CountA < BUFFER_SIZE)){
+              AnalogValue_re[CountA++] = Value;
+              avg += Value;
+          }
+          else if((Tag == AUX_ADC_CHANNEL_TAG) && (CountB < BUFFER_SIZE)){
+              AuxValue_re[CountB++] = Value;
+          }
+      }
+      for(; CountA < BUFFER_SIZE; CountA++){
+          AnalogValue_re[CountA] = (CountA > 0)? AnalogValue_re[CountA - 1] : 0.0;
+          avg += AnalogValue_re[CountA];
+      }
+      for(; CountB < BUFFER_SIZE; CountB++){
+          AuxValue_re[CountB] = (CountB > 0)? AuxValue_re[CountB - 1] : 0.0;
+      }
+    }
+
+    return avg / BUFFER_SIZE;
+}
+
+/*
+*   Function to compute the FFT of the sampled data.
+*   The output is left in the rfft layout, SpectrumPipeline::Magnitudes() turns it into magnitudes.
+*   Input: Pointer to FFT Config - to compute the FFT.
+*   Input: Pointer to a pruned FFT plan - only the bins of the plan are computed. NULL to compute all of them.
+*   Input: Pointer to a partial tracker - run on the complex output. NULL to skip it.
+*   Input: unsigned long Sequence - Capture number of the frame, for the partial tracker.
+*   Output: None.
+*/
+void ComputeFFT(fft_config_t *FFT, fft_pruned_plan_t *Plan, PartialTracker *Partials, unsigned long Sequence){
+//    FFT.DCRemoval();
+//    FFT.Windowing(FFT_WIN_TYP_HAMMING, FFT_FORWARD);
+//    FFT.Compute(FFT_FORWARD);
+//    FFT.ComplexToMagnitude();
+    if(Plan != NULL){
+      rfft_pruned(FFT->input, FFT->output, Plan);    //Do fft, only the bins we need.
+    }
+    else{
+      fft_execute(FFT);    //Do fft.
+    }
+
+    if(Partials != NULL){
+      TrackPartials(Partials, FFT->input, FFT->output, Sequence);
+    }
+    //Serial.println("FFT Done");
+}
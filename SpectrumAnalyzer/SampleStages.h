@@ -0,0 +1,41 @@
+/*
+    * SampleStages.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the format of the captures (sample rate, size,
+    *  the ADC channels tagged in the i2s words) and the stages of the sampled
+    *  data that do not touch the hardware: the conversion of the raw i2s words,
+    *  the FFT and the spectrum stage of an input. SignalSampler.h adds the i2s driver around them, the host
+    *  build of PipelineTiming.cpp runs them on a PC.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _SAMPLESTAGES_H
+#define _SAMPLESTAGES_H
+
+#include <stdint.h>
+#include "FFT.h"
+#include "PartialTracker.h"
+#include "PlotScale.h"
+#include "SpectrumPipeline.h"
+
+//Defines
+
+//Constants to define the sampling frequency and the number of samples to be taken.
+#define ReadFreq 11000
+#define BUFFER_SIZE 1024
+#define NumSeconds BUFFER_SIZE*(1.0/ReadFreq)
+#define ReadDelayUs 1000000.0*(1.0/ReadFreq)
+#define CAPTURE_PERIOD_US (BUFFER_SIZE * 1000000UL / ReadFreq)   //Time between two captures
+#define DUAL_CHANNEL 0                   //Setting this to 1 will also sample the AUX input and show both spectra
+#define ADC_CHANNEL_COUNT (DUAL_CHANNEL? 2 : 1)
+#define ADC_CHANNEL_TAG 6                //Number of ADC_CHANNEL_USED(ADC1_CHANNEL_6), the i2s words carry it in their top 4 bits
+#define AUX_ADC_CHANNEL_TAG 7            //Number of AUX_ADC_CHANNEL_USED(ADC1_CHANNEL_7)
+
+//Spectrum stage of one input, with DUAL_CHANNEL each input gets half of the bars.
+typedef SpectrumPipeline<BUFFER_SIZE, ReadFreq, FFTPLOT_CHANNEL / ADC_CHANNEL_COUNT, FFTPLOT_FREQ_START, FFTPLOT_FREQ_END> InputSpectrum;
+
+//Function Prototypes
+double ConvertSampledData(const int16_t* Raw, float* AnalogValue_re, float* AuxValue_re = NULL);
+void ComputeFFT(fft_config_t *FFT, fft_pruned_plan_t *Plan, PartialTracker *Partials = NULL, unsigned long Sequence = 0);
+#endif //_SAMPLESTAGES_H
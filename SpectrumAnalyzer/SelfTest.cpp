@@ -0,0 +1,927 @@
+/*
+*   SelfTest.cpp
+*   Created on: Oct 19, 2026
+*   Checks of the code that does not depend on the ESP32, one line of output each:
+*   - FFT kernels: the fft4/fft8 base cases, the split-radix codelets and every complex kernel against a plain DFT.
+*   - Real FFTs: rfft against the DFT, rfft_pruned and the in-place FFTs against rfft and the DFT.
+*   - Filter engine: the overlap-save filter of FilterEngine.h against direct convolution.
+*   - Power governor: PowerGovernor.h against a simulated clock and load trace.
+*   - Peak picker: PeakPicker.h on a made up spectrum and on two tones.
+*   - Signal generator: the synthetic sources of SignalGenerator.h that can stand in for the ADC.
+*   - Trigger: TriggerEngine.h on a 100 Hz sine, whose period is longer than the slack in front of its window.
+*   - Latency monitor: the histogram of LatencyMonitor.h, its statistics and percentiles.
+*   - Event recorder: the compressed ring of EventRecorder.h decodes bit for bit, also once it wraps.
+*   - Pitch detector: PitchDetector.h on sine and sawtooth notes from A2 to B5.
+*   - Frame scheduler: the deadlines, missed frames and jitter of FrameScheduler.h against a simulated clock, with and without a stall of the source.
+*   - Timing: rfft against SELFTEST_PERF_LIMIT_NS, and the codelets against the recursive split-radix FFT (printed only).
+*   In the sketch it is run from setup() when SELF_TEST is 1. Built on its own
+*   (ARDUINO not defined) it has a main() and returns the number of failed checks.
+*/
+#include "SelfTest.h"
+#include "FFT.h"
+#include "FilterEngine.h"
+#include "PowerGovernor.h"
+#include "PeakPicker.h"
+#include "SignalGenerator.h"
+#include "TriggerEngine.h"
+#include "LatencyMonitor.h"
+#include "EventRecorder.h"
+#include "PitchDetector.h"
+#include "FrameScheduler.h"
+#include <string.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#define SELFTEST_PRINTF Serial.printf
+#else
+#include <chrono>
+#define SELFTEST_PRINTF printf
+#endif
+
+//Scratch buffers, allocated for the largest size by RunFFTSelfTest()
+static float *In;                               //Input of the transform under test (2*SELFTEST_MAX_SIZE)
+static float *Out;                              //Output of the transform under test (2*SELFTEST_MAX_SIZE)
+static float *Ref;                              //Output of the reference DFT (2*SELFTEST_MAX_SIZE)
+static float *Twiddle;                          //Twiddle factors handed to the kernels (2*SELFTEST_MAX_SIZE)
+static float *RefTwiddle;                       //Twiddle factors of the reference DFT, computed in double (2*SELFTEST_MAX_SIZE)
+static unsigned char *Masks;                    //Masks of the pruned FFT plan (SELFTEST_MAX_SIZE)
+static unsigned short *BitReverse;              //Permutation of the in-place FFT (SELFTEST_MAX_SIZE)
+static uint32_t Seed;                           //State of the random number generator
+static int Failures;                            //Number of checks that failed
+
+typedef void (*ComplexKernel)(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
+
+/*
+*   Function to get the time in microseconds, on the ESP32 and on a PC.
+*   Input: None.
+*   Output: unsigned long - Microseconds from an arbitrary start.
+*/
+static unsigned long SelfTestMicros(){
+#ifdef ARDUINO
+  return micros();
+#else
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/*
+*   Function to get a repeatable pseudo random sample.
+*   Input: None.
+*   Output: float - A value between -1 and 1.
+*/
+static float RandomSample(){
+  Seed = Seed * 1664525u + 1013904223u;
+  return (Seed >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+/*
+*   Function to fill the buffer with random samples.
+*   Input: float *Buffer - The buffer to fill.
+*          int Count - Number of floats to write.
+*   Output: None.
+*/
+static void FillRandom(float *Buffer, int Count){
+  for(int i = 0; i < Count; i++){
+    Buffer[i] = RandomSample();
+  }
+}
+
+/*
+*   Function to compute the DFT the slow way, used as the reference for every check.
+*   Input: const float *x - Complex input, real/imaginary interleaved.
+*          int n - The DFT size.
+*          int Stride - Floats between two successive input samples.
+*          float *X - Complex output, real/imaginary interleaved (2*n).
+*   Output: None.
+*/
+static void ReferenceDFT(const float *x, int n, int Stride, float *X){
+  for(int k = 0; k < n; k++){
+    RefTwiddle[2*k] = (float)cos(2.0 * M_PI * k / n);
+    RefTwiddle[2*k + 1] = (float)sin(2.0 * M_PI * k / n);
+  }
+  for(int k = 0; k < n; k++){
+    float SumRe = 0, SumIm = 0;
+    for(int j = 0; j < n; j++){
+      int t = (int)(((long)j * k) % n);
+      float c = RefTwiddle[2*t], s = RefTwiddle[2*t + 1];
+      float xr = x[j*Stride], xi = x[j*Stride + 1];
+      SumRe += c * xr + s * xi;
+      SumIm += c * xi - s * xr;
+    }
+    X[2*k] = SumRe;
+    X[2*k + 1] = SumIm;
+  }
+}
+
+/*
+*   Function to get the error between an output and its reference.
+*   Input: const float *Value, const float *Expected - The two arrays.
+*          int Start, int End - Range of floats compared, End excluded.
+*   Output: float - Largest difference relative to the largest expected value.
+*/
+static float RelativeError(const float *Value, const float *Expected, int Start, int End){
+  float MaxDiff = 0, MaxValue = 1e-20f;
+  for(int i = Start; i < End; i++){
+    MaxDiff = fmaxf(MaxDiff, fabsf(Value[i] - Expected[i]));
+    MaxValue = fmaxf(MaxValue, fabsf(Expected[i]));
+  }
+  return MaxDiff / MaxValue;
+}
+
+/*
+*   Function to print the outcome of a check and count it if it failed.
+*   Input: const char *Name - Name of the check.
+*          float WorstError - Largest error over all sizes.
+*          int WorstSize - The size the largest error was seen at.
+*   Output: None.
+*/
+static void Report(const char *Name, float WorstError, int WorstSize){
+  bool Pass = WorstError <= SELFTEST_TOLERANCE;
+  SELFTEST_PRINTF("%-24s worst error %.2e (n = %d) %s\n", Name, WorstError, WorstSize, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to keep the largest error seen so far.
+*   Input: float Error - Error of the current size.
+*          int Size - The current size.
+*          float *WorstError, int *WorstSize - The largest error so far and its size.
+*   Output: None.
+*/
+static void TrackWorst(float Error, int Size, float *WorstError, int *WorstSize){
+  //NaN never compares larger, so it is forced to be the worst.
+  if(Error > *WorstError || Error != Error){
+    *WorstError = (Error != Error)? 1e30f : Error;
+    *WorstSize = Size;
+  }
+}
+
+/*
+*   Function to check the unrolled fft4 and fft8 base cases, with packed and strided input.
+*   Input: None.
+*   Output: None.
+*/
+static void TestBaseCases(){
+  const int Strides[] = {2, 6};
+  for(int n = 4; n <= 8; n *= 2){
+    float WorstError = 0;
+    int WorstSize = n;
+    for(int s = 0; s < 2; s++){
+      FillRandom(In, n * Strides[s]);
+      ReferenceDFT(In, n, Strides[s], Ref);
+      if(n == 4){
+        fft4(In, Strides[s], Out, 2);
+      }
+      else{
+        fft8(In, Strides[s], Out, 2);
+      }
+      TrackWorst(RelativeError(Out, Ref, 0, 2*n), n, &WorstError, &WorstSize);
+    }
+    Report(n == 4? "fft4" : "fft8", WorstError, WorstSize);
+  }
+}
+
+/*
+*   Function to check the straight-line split-radix codelets, with packed and strided input.
+*   Input: None.
+*   Output: None.
+*/
+static void TestCodelets(){
+  fft_config_t Config;
+  const int Strides[] = {2, 6};
+  const int Sizes[] = {16, 32, 64};
+  for(int i = 0; i < 3; i++){
+    int n = Sizes[i];
+    float WorstError = 0;
+    int WorstSize = n;
+    fft_init_static(&Config, Twiddle, n, FFT_COMPLEX, FFT_FORWARD, In, Out);
+    for(int s = 0; s < 2; s++){
+      FillRandom(In, n * Strides[s]);
+      ReferenceDFT(In, n, Strides[s], Ref);
+      split_radix_fft_fixed(In, Out, n, Strides[s], Twiddle, 2);
+      TrackWorst(RelativeError(Out, Ref, 0, 2*n), n, &WorstError, &WorstSize);
+    }
+    Report(n == 16? "fft16 codelet" : (n == 32? "fft32 codelet" : "fft64 codelet"), WorstError, WorstSize);
+  }
+}
+
+/*
+*   Function to check a complex FFT kernel against the reference DFT for every size.
+*   Both kernels are checked no matter which one USE_SPLIT_RADIX selects for rfft.
+*   Input: const char *Name - Name of the check.
+*          ComplexKernel Kernel - split_radix_fft or fft_primitive.
+*   Output: None.
+*/
+static void TestComplexKernel(const char *Name, ComplexKernel Kernel){
+  fft_config_t Config;
+  float WorstError = 0;
+  int WorstSize = 8;
+  for(int n = 8; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_COMPLEX, FFT_FORWARD, In, Out);
+    FillRandom(In, 2*n);
+    ReferenceDFT(In, n, 2, Ref);
+    Kernel(In, Out, n, 2, Twiddle, 2);
+    TrackWorst(RelativeError(Out, Ref, 0, 2*n), n, &WorstError, &WorstSize);
+  }
+  Report(Name, WorstError, WorstSize);
+}
+
+/*
+*   Function to check rfft against the reference DFT, the irfft round trip and Parseval's theorem.
+*   Input: None.
+*   Output: None.
+*/
+static void TestRealFFT(){
+  fft_config_t Config;
+  float WorstError[3] = {0, 0, 0};
+  int WorstSize[3] = {16, 16, 16};
+  for(int n = 16; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+    FillRandom(In, n);
+    //The reference works on complex samples, the imaginary parts are 0.
+    for(int i = n - 1; i >= 0; i--){
+      Out[2*i] = In[i];
+      Out[2*i + 1] = 0;
+    }
+    ReferenceDFT(Out, n, 2, Ref);
+    //rfft keeps the (real) center bin where the imaginary part of the DC bin would be.
+    Ref[1] = Ref[n];
+    rfft(In, Out, Twiddle, n);
+    TrackWorst(RelativeError(Out, Ref, 0, n), n, &WorstError[0], &WorstSize[0]);
+
+    //Parseval, the energy of the samples equals the energy of the spectrum over n.
+    double TimeEnergy = 0, FreqEnergy = Out[0] * Out[0] + Out[1] * Out[1];
+    for(int i = 0; i < n; i++){
+      TimeEnergy += In[i] * In[i];
+    }
+    for(int i = 2; i < n; i++){
+      FreqEnergy += 2.0 * Out[i] * Out[i];
+    }
+    TrackWorst(fabs(TimeEnergy - FreqEnergy / n) / TimeEnergy, n, &WorstError[1], &WorstSize[1]);
+
+    //irfft destroys its input, so it gets a copy of the spectrum.
+    memcpy(Ref, Out, n * sizeof(float));
+    irfft(Ref, Out, Twiddle, n);
+    TrackWorst(RelativeError(Out, In, 0, n), n, &WorstError[2], &WorstSize[2]);
+  }
+  Report("rfft", WorstError[0], WorstSize[0]);
+  Report("rfft Parseval", WorstError[1], WorstSize[1]);
+  Report("rfft/irfft round trip", WorstError[2], WorstSize[2]);
+}
+
+/*
+*   Function to check the in-place FFTs: fft_inplace against the reference DFT and rfft_inplace against rfft.
+*   Input: None.
+*   Output: None.
+*/
+static void TestInPlaceFFT(){
+  fft_config_t Config;
+  float WorstError[2] = {0, 0};
+  int WorstSize[2] = {2, 16};
+  for(int n = 2; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_COMPLEX, FFT_FORWARD, In, Out);
+    FillRandom(In, 2*n);
+    ReferenceDFT(In, n, 2, Ref);
+    int Pairs = fft_bitrev_init(BitReverse, n);
+    fft_inplace(In, n, Twiddle, 2, BitReverse, Pairs);
+    TrackWorst(RelativeError(In, Ref, 0, 2*n), n, &WorstError[0], &WorstSize[0]);
+  }
+  for(int n = 16; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+    FillRandom(In, n);
+    rfft(In, Ref, Twiddle, n);
+    int Pairs = fft_bitrev_init(BitReverse, n / 2);
+    rfft_inplace(In, Twiddle, n, BitReverse, Pairs);
+    TrackWorst(RelativeError(In, Ref, 0, n), n, &WorstError[1], &WorstSize[1]);
+  }
+  Report("fft_inplace", WorstError[0], WorstSize[0]);
+  Report("rfft_inplace", WorstError[1], WorstSize[1]);
+}
+
+/*
+*   Function to check that rfft_pruned matches rfft on the bins of its plan.
+*   Input: None.
+*   Output: None.
+*/
+static void TestPrunedFFT(){
+  fft_config_t Config;
+  fft_pruned_plan_t Plan;
+  float WorstError = 0;
+  int WorstSize = 16;
+  for(int n = 16; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+    int BinStart = n / 64 + 1, BinEnd = n / 4;
+    rfft_pruned_init(&Plan, Masks, Twiddle, n, BinStart, BinEnd);
+    FillRandom(In, n);
+    rfft(In, Ref, Twiddle, n);
+    rfft_pruned(In, Out, &Plan);
+    TrackWorst(RelativeError(Out, Ref, 2*BinStart, 2*BinEnd + 2), n, &WorstError, &WorstSize);
+  }
+  Report("rfft_pruned", WorstError, WorstSize);
+}
+
+/*
+*   Function to check the overlap-save filter against direct convolution.
+*   The samples go through the engine in two calls, so the overlap carried between frames is checked too.
+*   Input: None.
+*   Output: None.
+*/
+static void TestFilterEngine(){
+  int n = SELFTEST_MAX_SIZE - SELFTEST_MAX_SIZE % (2 * FILTER_BLOCK);
+  float WorstError = 0;
+  int WorstSize = n;
+  float *Buffer = (float *)malloc(FILTER_BUFFER_FLOATS * sizeof(float));
+  float *Taps = (float *)malloc(FILTER_MAX_TAPS * sizeof(float));
+  if(Buffer == NULL || Taps == NULL || n == 0){
+    TrackWorst(1e30f, n, &WorstError, &WorstSize);
+  }
+  else{
+    FilterEngine Engine;
+    FillRandom(Taps, FILTER_MAX_TAPS);
+    InitializeFilterEngine(&Engine, Buffer, Taps, FILTER_MAX_TAPS);
+    FillRandom(In, n);
+    DirectConvolution(In, n, Taps, FILTER_MAX_TAPS, NULL, Ref);
+    RunFilterEngine(&Engine, In, Out, n/2, 0);
+    memcpy(Out + n/2, In + n/2, n/2 * sizeof(float));
+    RunFilterEngine(&Engine, Out + n/2, Out + n/2, n/2, 0);        //In place
+    TrackWorst(RelativeError(Out, Ref, 0, n), n, &WorstError, &WorstSize);
+  }
+  free(Buffer);
+  free(Taps);
+  Report("overlap-save filter", WorstError, WorstSize);
+}
+
+/*
+*   Function to run the power governor against a simulated clock and load trace.
+*   Frames come every CAPTURE_PERIOD apart: 2 s of signal, then silence at a light load, then a
+*   heavy load at the lowest level, then the signal comes back. The bars are display data on the
+*   scale of the pipeline (about 800 per pixel) with a jitter below a pixel, which is not redrawn
+*   below full power, while a bar that grows by a few pixels, or creeps up a little every frame, is.
+*   Then the same for the waveform plot, from its samples.
+*   Input: None.
+*   Output: None.
+*/
+static void TestPowerGovernor(){
+  const unsigned long Period = 93090;           //1024 samples at 11 kHz
+  const uint32_t Base[4] = {8000, 16000, 24000, 32000};        //10, 20, 30 and 40 pixels
+  PowerGovernor G;
+  unsigned long Now = 1000;
+  bool Pass = true;
+  uint32_t Bars[4];
+  memcpy(Bars, Base, sizeof(Bars));
+  InitializePowerGovernor(&G, Now);
+  //Signal: full power, every frame drawn even if the bars do not move
+  for(int i = 0; i < 22; i++, Now += Period){
+    Pass &= UpdatePowerGovernor(&G, Now, 50.0, false, 20000, Period) == POWER_FULL;
+    Pass &= !PowerSkipRender(&G, Bars, NULL, 4, 1) && !PowerSkipCompute(&G, 50.0);
+  }
+  //Silence: quiet after POWER_QUIET_DELAY_US, idle after POWER_IDLE_DELAY_US. The jitter is never drawn.
+  unsigned long SilenceStart = Now - Period;    //Last frame with signal
+  unsigned long QuietAt = 0, IdleAt = 0;
+  for(int i = 0; i < 80; i++, Now += Period){
+    uint8_t Level = UpdatePowerGovernor(&G, Now, 1.0, false, 20000, Period);
+    QuietAt = (Level == POWER_QUIET && QuietAt == 0)? Now - SilenceStart : QuietAt;
+    IdleAt = (Level == POWER_IDLE && IdleAt == 0)? Now - SilenceStart : IdleAt;
+    for(int b = 0; b < 4; b++){
+      Bars[b] = Base[b] + (i * 397 + b * 131) % 600 - 300;
+    }
+    Pass &= (Level == POWER_FULL) || PowerSkipRender(&G, Bars, NULL, 4, 1);
+  }
+  Pass &= QuietAt >= POWER_QUIET_DELAY_US && QuietAt < POWER_QUIET_DELAY_US + 2 * Period;
+  Pass &= IdleAt >= POWER_IDLE_DELAY_US && IdleAt < POWER_IDLE_DELAY_US + 2 * Period;
+  Pass &= PowerSkipCompute(&G, 1.0);
+  //Below full power: a bar a few pixels higher is drawn, and one creeping up by half a pixel a frame is drawn every few frames.
+  memcpy(Bars, Base, sizeof(Bars));
+  Pass &= PowerSkipRender(&G, Bars, NULL, 4, 1);
+  Bars[1] += 3 * 800;
+  Pass &= !PowerSkipRender(&G, Bars, NULL, 4, 1);
+  int Drawn = 0;
+  for(int i = 0; i < 12; i++){
+    Bars[3] += 400;
+    Drawn += !PowerSkipRender(&G, Bars, NULL, 4, 1);
+  }
+  Pass &= (Drawn >= 3) && (Drawn <= 6);
+  //Too much load at the lowest clock: one level up, and held there
+  Pass &= UpdatePowerGovernor(&G, Now, 1.0, false, 80000, Period) == POWER_QUIET;
+  Now += Period;
+  for(int i = 0; i < 20; i++, Now += Period){
+    Pass &= UpdatePowerGovernor(&G, Now, 1.0, false, 30000, Period) == POWER_QUIET;
+  }
+  //Waveform below full power: the same samples are not drawn again, a louder waveform is.
+  for(int i = 0; i < 320; i++){
+    In[i] = 1350 + 50 * sinf(i * 0.2f);
+  }
+  Pass &= !PowerSkipRender(&G, NULL, In, 160, 2);
+  Pass &= PowerSkipRender(&G, NULL, In, 160, 2);
+  for(int i = 0; i < 320; i++){
+    In[i] = 1350 + 500 * sinf(i * 0.2f);
+  }
+  Pass &= !PowerSkipRender(&G, NULL, In, 160, 2);
+  //Signal is back: full power on that very frame, and the bars are drawn
+  Pass &= UpdatePowerGovernor(&G, Now, 50.0, false, 30000, Period) == POWER_FULL;
+  Pass &= !PowerSkipCompute(&G, 50.0) && !PowerSkipRender(&G, Bars, NULL, 4, 1);
+  //A wake up (button) does the same in silence
+  InitializePowerGovernor(&G, Now);
+  for(int i = 0; i < 80; i++, Now += Period){
+    UpdatePowerGovernor(&G, Now, 1.0, false, 20000, Period);
+  }
+  Pass &= UpdatePowerGovernor(&G, Now, 1.0, true, 20000, Period) == POWER_FULL;
+  SELFTEST_PRINTF("%-24s quiet after %lu ms, idle after %lu ms %s\n", "power governor", QuietAt / 1000, IdleAt / 1000, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to check the peak picker.
+*   1. Magnitudes made up to hit every rule: a peak next to a stronger one(spacing), a bump on the
+*      shoulder of a peak(prominence, the shoulder must not count as the valley of the peak) and a row
+*      of small peaks of which only the strongest fit(top K).
+*   2. The rfft of two tones between the bins, they have to come out within 0.1 bin.
+*   Input: None.
+*   Output: None.
+*/
+static void TestPeakPicker(){
+  PeakPicker P;
+  SpectralPeak Peaks[4];
+  bool Pass = true;
+  //1. Made up magnitudes.
+  float Magnitude[128];
+  for(int k = 0; k < 128; k++){
+    Magnitude[k] = 1;
+  }
+  Magnitude[19] = 50; Magnitude[20] = 100; Magnitude[21] = 10; Magnitude[22] = 80; Magnitude[23] = 30;
+  const float Shoulder[7] = {60, 59, 58, 57, 56, 57.5, 1};
+  memcpy(&Magnitude[40], Shoulder, sizeof(Shoulder));
+  for(int j = 0; j < 10; j++){
+    Magnitude[60 + 4*j] = 10 + j;
+  }
+  Magnitude[110] = 4;                           //Below the threshold
+  InitializePeakPicker(&P, 5, 6, 3);
+  int Count = FindPeaks(&P, Magnitude, false, 1, 120, Peaks, 4);
+  const int Expected[4] = {20, 40, 96, 92};
+  Pass &= (Count == 4);
+  for(int i = 0; i < Count && i < 4; i++){
+    Pass &= (Peaks[i].Index == Expected[i]) && fabsf(Peaks[i].Bin - Expected[i]) <= 0.5f;
+  }
+  Pass &= (Count > 0) && Peaks[0].Bin < 20 && Peaks[0].Magnitude >= 100;      //Leans to the louder neighbour, above the peak bin
+  //2. Two tones.
+  const int n = 1024;
+  const float Bins[2] = {100.3f, 160.7f}, Amplitudes[2] = {1000, 400};
+  fft_config_t Config;
+  fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+  for(int i = 0; i < n; i++){
+    In[i] = Amplitudes[0] * cosf(2 * M_PI * Bins[0] * i / n) + Amplitudes[1] * cosf(2 * M_PI * Bins[1] * i / n + 1.0);
+  }
+  rfft(In, Out, Twiddle, n);
+  InitializePeakPicker(&P, 20 * n / 2, PEAK_MIN_PROMINENCE, PEAK_MIN_SPACING);
+  Count = FindPeaks(&P, Out, true, 1, n/2 - 2, Peaks, 4);
+  float WorstBin = 0;
+  Pass &= (Count == 2);
+  for(int i = 0; i < Count && i < 2; i++){
+    float Error = fabsf(Peaks[i].Bin - Bins[i]);
+    WorstBin = (Error > WorstBin)? Error : WorstBin;
+  }
+  Pass &= (WorstBin < 0.1f);
+  SELFTEST_PRINTF("%-24s %d peaks, worst position error %.3f bins %s\n", "peak picker", Count, WorstBin, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to check the synthetic sources the sketch can feed instead of the ADC.
+*   1. The tones of the multitone source have to come out of the FFT where they were put, within 0.1 bin.
+*   2. The impulse source has to keep to its Period.
+*   Input: None.
+*   Output: None.
+*/
+static void TestSignalGenerator(){
+  const float SampleRate = 11000;
+  const float Tones[5] = {220.0, 440.0, 1000.0, 2500.0, 4000.0};     //SignalMultiTone[]
+  const int n = SELFTEST_MAX_SIZE;
+  bool Pass = true;
+  //1. Multitone through the FFT and the peak picker.
+  SignalGenerator Gen;
+  InitializeSignalGenerator(&Gen, SIGNAL_MULTITONE, SampleRate, 0, 0, 1500);
+  for(int i = 0; i < n; i++){
+    In[i] = NextSignalSample(&Gen);
+  }
+  fft_config_t Config;
+  fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+  rfft(In, Out, Twiddle, n);
+  PeakPicker P;
+  SpectralPeak Peaks[8];
+  InitializePeakPicker(&P, 1500 / 10 * n / 2, PEAK_MIN_PROMINENCE, PEAK_MIN_SPACING);
+  int Count = FindPeaks(&P, Out, true, 1, n/2 - 2, Peaks, 8);
+  float WorstBin = 0;
+  int Matched = 0;
+  for(int t = 0; t < 5; t++){
+    float Bin = Tones[t] * n / SampleRate;
+    for(int i = 0; i < Count; i++){
+      float Error = fabsf(Peaks[i].Bin - Bin);
+      if(Error < 0.5f){
+        WorstBin = (Error > WorstBin)? Error : WorstBin;
+        Matched++;
+      }
+    }
+  }
+  Pass &= (Count == 5) && (Matched == 5) && (WorstBin < 0.1f);
+  //2. Impulses every Period samples.
+  InitializeSignalGenerator(&Gen, SIGNAL_IMPULSE, SampleRate, 0, 0, 1500);
+  Gen.Period = 100;
+  int Impulses = 0;
+  for(int i = 0; i < 350; i++){
+    bool Impulse = NextSignalSample(&Gen) != 0;
+    Impulses += Impulse;
+    Pass &= (Impulse == (i % 100 == 0));
+  }
+  Pass &= (Impulses == 4);
+  SELFTEST_PRINTF("%-24s %d of 5 tones, worst position error %.3f bins %s\n", "signal generator", Matched, WorstBin, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to check the trigger on a 100 Hz sine. Its period is 110 samples, longer than the 64 samples
+*   a capture of 1024 leaves in front of a window of 960, so most edges are found in the end of the capture before.
+*   Every capture but the first has to trigger on a rising zero crossing, and the window has to be the
+*   signal from there on, also where it is carried across the boundary.
+*   Input: None.
+*   Output: None.
+*/
+static void TestTriggerEngine(){
+  const int n = SELFTEST_MAX_SIZE, Window = n * 15 / 16;
+  const double Step = 2 * M_PI * 100.0 / 11000;
+  TriggerEngine T;
+  InitializeTriggerEngine(&T, TRIGGER_RISING, TRIGGER_NORMAL, 0, TRIGGER_HYSTERESIS, 0, Window, Out);
+  int Drawn = 0, Wrong = 0;
+  bool Pass = true;
+  for(unsigned long Sequence = 1; Sequence <= 20; Sequence++){
+    for(int i = 0; i < n; i++){
+      In[i] = (float)(1000 * sin(Step * ((Sequence - 1) * n + i)));
+    }
+    int Start = FindTrigger(&T, In, n, 0, Sequence);
+    if(Start < 0){
+      continue;
+    }
+    Drawn++;
+    long First = (long)T.LastTrigger - n;       //Sample number of the trigger, the first capture is number 1
+    Pass &= (First >= 1) && ((float)(1000 * sin(Step * First)) >= 0) && ((float)(1000 * sin(Step * (First - 1))) < 0);
+    for(int m = 0; m < Window; m++){
+      Wrong += (In[Start + m] != (float)(1000 * sin(Step * (First + m))));
+    }
+  }
+  Pass &= (Drawn == 19) && (Wrong == 0);
+  SELFTEST_PRINTF("%-24s %d of 19 captures drawn, %d samples off %s\n", "trigger 100 Hz", Drawn, Wrong, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to check the latency histogram: the bins, the longest latencies in the last bin,
+*   the statistics and the percentiles, which are the upper edge of their bin but at most Max.
+*   Input: None.
+*   Output: None.
+*/
+static void TestLatencyMonitor(){
+  LatencyMonitor L;
+  InitializeLatencyMonitor(&L);
+  bool Pass = (LatencyPercentile(&L, 0.5) == 0);
+  for(int i = 0; i < 100; i++){
+    RecordLatency(&L, (i < 50)? 15000 : ((i < 95)? 30000 : 500000));
+  }
+  Pass &= (L.Count == 100) && (L.Min == 15000) && (L.Max == 500000) && (L.Sum == 4600000);
+  Pass &= (L.Histogram[0] == 50) && (L.Histogram[1] == 45) && (L.Histogram[LATENCY_HIST_BINS - 1] == 5);
+  unsigned long Median = LatencyPercentile(&L, 0.5), P95 = LatencyPercentile(&L, 0.95), P99 = LatencyPercentile(&L, 0.99);
+  Pass &= (Median == LATENCY_HIST_BIN_US) && (P95 == 2 * LATENCY_HIST_BIN_US) && (P99 == 500000);
+  //All in the first bin, its edge is above Max.
+  InitializeLatencyMonitor(&L);
+  RecordLatency(&L, 12000);
+  RecordLatency(&L, 9000);
+  Pass &= (L.Min == 9000) && (LatencyPercentile(&L, 0.95) == 12000);
+  SELFTEST_PRINTF("%-24s median <= %lu us, 95%% <= %lu us, 99%% <= %lu us %s\n", "latency monitor", Median, P95, P99, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+//Buffers of the event recorder check
+static float EventSamples[SELFTEST_EVENT_SAMPLES];          //A capture
+static int16_t EventDecoded[SELFTEST_EVENT_SAMPLES];        //A capture decoded from the ring
+static uint8_t EventRing[SELFTEST_EVENT_RING];              //The ring of the recorder
+
+/*
+*   Function to make the captures of the event recorder check, the same ones again for the same number.
+*   Capture 1 is silence, 2 a full-scale square wave, the others uniform noise over the whole range.
+*   Input: float *x - Set to the capture, whole ADC values from 1 to EVENT_SAMPLE_MAX.
+*   Input: int n - Number of samples.
+*   Input: unsigned long Sequence - Capture number.
+*   Output: None.
+*/
+static void EventCapture(float *x, int n, unsigned long Sequence){
+  uint32_t State = 2654435761u * Sequence;
+  for(int i = 0; i < n; i++){
+    State = State * 1664525u + 1013904223u;
+    if(Sequence == 1){
+      x[i] = 2048;
+    }
+    else if(Sequence == 2){
+      x[i] = ((i / 16) % 2)? EVENT_SAMPLE_MAX : 1;
+    }
+    else{
+      x[i] = 1 + (State >> 8) % EVENT_SAMPLE_MAX;
+    }
+  }
+}
+
+/*
+*   Function to check that every capture held by the event recorder decodes to what was recorded, bit for bit.
+*   Input: const EventRecorder *R - The recorder.
+*   Input: int n - Samples of every capture.
+*   Output: bool - True if all of them match.
+*/
+static bool EventRingMatches(const EventRecorder *R, int n){
+  bool Pass = true;
+  for(int b = 0; b < R->Count; b++){
+    const EventBlock *B = &R->Blocks[(R->Oldest + b) % EVENT_MAX_BLOCKS];
+    EventCapture(EventSamples, n, B->Sequence);
+    Pass &= (DecodeEventBlock(R, b, EventDecoded) == n);
+    for(int i = 0; i < n; i++){
+      Pass &= (EventDecoded[i] == (int16_t)EventSamples[i]);
+    }
+  }
+  return Pass;
+}
+
+/*
+*   Function to check the event recorder on a small ring. Silence, a full-scale square wave, whose steps
+*   of 4095 only fit the raw EVENT_ESCAPE_BITS code, and noise have to decode bit for bit. Then more noise
+*   wraps the ring, the oldest captures have to make room and the ones left, also those across the end
+*   of the ring, still have to decode bit for bit.
+*   Input: None.
+*   Output: None.
+*/
+static void TestEventRecorder(){
+  const int n = SELFTEST_EVENT_SAMPLES, Captures = 12;
+  static EventRecorder R;
+  InitializeEventRecorder(&R, EventRing, SELFTEST_EVENT_RING);
+  bool Pass = true, Wrapped = false;
+  for(unsigned long Sequence = 1; Sequence <= Captures; Sequence++){
+    EventCapture(EventSamples, n, Sequence);
+    Pass &= (RecordCapture(&R, EventSamples, n, Sequence) > 0);
+    const EventBlock *B = &R.Blocks[(R.Oldest + R.Count - 1) % EVENT_MAX_BLOCKS];
+    if(Sequence == 2){
+      Pass &= (((2u * (EVENT_SAMPLE_MAX - 1)) >> B->Rice) >= EVENT_RICE_ESCAPE);   //Zigzag of a step up, it needs the escape
+    }
+    if(Sequence == 3){
+      Pass &= (R.Count == 3);                   //Nothing evicted yet
+    }
+    Wrapped |= (B->Start + B->Bytes > R.Size);
+    Pass &= (R.Used <= R.Size) && (B->Sequence == Sequence) && (R.Blocks[R.Oldest].Sequence == Sequence - R.Count + 1);
+    Pass &= EventRingMatches(&R, n);
+  }
+  Pass &= Wrapped && (R.Count < Captures) && (R.Blocks[R.Oldest].Sequence > 1);
+  SELFTEST_PRINTF("%-24s %d of %d captures held, %.2f bits per sample %s\n", "event recorder", R.Count, Captures, 8.0 * R.BytesOut / R.SamplesIn, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to check the pitch detector on every note from A2 (110 Hz) to B5 (988 Hz) at the defaults of the
+*   sketch, as a sine, as a sawtooth with all its harmonics below the Nyquist frequency and as that sawtooth in noise,
+*   over an ADC offset. Every note has to be found within SELFTEST_PITCH_CENTS. In the noise the dip of the period is
+*   above PITCH_YIN_THRESHOLD for some notes, the deepest dip is then often a multiple of it and the octave check has to fix that.
+*   Input: None.
+*   Output: None.
+*/
+static void TestPitchDetector(){
+  const int n = SELFTEST_MAX_SIZE;
+  const float Rate = 11000;
+  fft_config_t Config;
+  fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+  PitchDetector P;
+  InitializePitchDetector(&P, Twiddle, Ref, n, Rate);
+  float Worst[3] = {0, 0, 0};
+  int WorstMidi[3] = {0, 0, 0}, Missed = 0;
+  for(int Wave = 0; Wave < 3; Wave++){
+    for(int Midi = 45; Midi <= 83; Midi++){
+      double Freq = 440 * pow(2, (Midi - 69) / 12.0), Phase = 0.3 * Midi;
+      double Average = 0;
+      for(int i = 0; i < n; i++){
+        double Value = 0;
+        for(int k = 1; k == 1 || (Wave >= 1 && k * Freq < Rate / 2); k++){
+          Value += sin(k * (2 * M_PI * Freq * i / Rate + Phase)) / k;
+        }
+        In[i] = (float)(2048 + 1000 * Value + ((Wave == 2)? 600 * RandomSample() : 0));
+        Average += In[i];
+      }
+      float Pitch = DetectPitch(&P, In, Average / n, Out);
+      float Cents = (Pitch > 0)? fabs(1200 * log2(Pitch / Freq)) : 1200;
+      Missed += (Cents > SELFTEST_PITCH_CENTS);
+      if(Cents > Worst[Wave]){
+        Worst[Wave] = Cents;
+        WorstMidi[Wave] = Midi;
+      }
+    }
+  }
+  bool Pass = (Missed == 0);
+  SELFTEST_PRINTF("%-24s worst sine %.1f, sawtooth %.1f, in noise %.1f cents (MIDI %d, %d, %d), %d of 117 off %s\n", "pitch detector",
+                  Worst[0], Worst[1], Worst[2], WorstMidi[0], WorstMidi[1], WorstMidi[2], Missed, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to get when a frame of the frame scheduler check is ready for the visualization task. Captures of
+*   1024 samples at 11 kHz, processed in 20 ms give or take 4 ms. From capture StallFrom on the source comes StallUs later.
+*   Input: int k - Capture number.
+*   Input: int StallFrom - First capture after the stall.
+*   Input: unsigned long StallUs - Length of the stall(us).
+*   Output: unsigned long - Time the frame is ready(us).
+*/
+static unsigned long FrameReadyUs(int k, int StallFrom, unsigned long StallUs){
+  return (unsigned long)(k * (1024 * 1000000.0 / 11000)) + 20000 + (k * 7919 % 9 - 4) * 1000 + ((k >= StallFrom)? StallUs : 0);
+}
+
+/*
+*   Function to run the frame scheduler against a simulated clock the way the visualization task does: sleep to
+*   the deadline in whole milliseconds, draw the newest frame that is ready, or wait for the next one if there is none.
+*   Input: FrameScheduler *S - The scheduler, set up.
+*   Input: int Captures - Number of captures.
+*   Input: int StallFrom - First capture after a stall of the source.
+*   Input: unsigned long StallUs - Length of the stall(us), 0 for none.
+*   Input: int SlowFrame - Capture that takes SlowUs to render, the others take 15 ms.
+*   Input: unsigned long SlowUs - Its render time(us).
+*   Output: int - Frames that were never drawn, a newer one was ready.
+*/
+static int SimulateFrames(FrameScheduler *S, int Captures, int StallFrom, unsigned long StallUs, int SlowFrame, unsigned long SlowUs){
+  unsigned long Now = 0;
+  int Next = 0, Dropped = 0;
+  while(Next < Captures){
+    long Wait = FrameTimeToDeadline(S, Now);
+    if(Wait > 0){
+      Now += (Wait + 999) / 1000 * 1000;
+    }
+    int Newest = -1;
+    for(int k = Next; k < Captures && FrameReadyUs(k, StallFrom, StallUs) <= Now; k++){
+      Newest = k;
+    }
+    if(Newest < 0){
+      FrameStarved(S);
+      Now = FrameReadyUs(Next, StallFrom, StallUs);
+      continue;
+    }
+    Dropped += Newest - Next;
+    Next = Newest + 1;
+    FrameStarted(S, Now);
+    Now += (Newest == SlowFrame)? SlowUs : 15000;
+    FrameFinished(S, Now);
+  }
+  return Dropped;
+}
+
+/*
+*   Function to check the deadline and jitter accounting of the frame scheduler at the defaults of the sketch,
+*   24 fps asked for and a capture every 93 ms.
+*   1. Frames every capture: the period is the capture period and every frame is drawn on its deadline, give
+*      or take the millisecond of the sleep. One frame renders for 250 ms, the frame after it starts late and misses its
+*      deadline, the deadline after that is skipped and a frame that was ready in between is never drawn.
+*   2. The source stalls for a second: one starved deadline, the frame that ends the wait starts a new grid and
+*      is not missed, the frames after it are on their deadlines again.
+*   Input: None.
+*   Output: None.
+*/
+static void TestFrameScheduler(){
+  const int Captures = 200;
+  const unsigned long Period = 93090;           //1024 samples at 11 kHz
+  FrameScheduler S;
+  InitializeFrameScheduler(&S, 24, Period, 0);
+  int Dropped = SimulateFrames(&S, Captures, Captures, 0, 100, 250000);
+  bool Pass = (S.PeriodUs == Period) && (S.Starved == 0) && (S.Missed == 1) && (S.Skipped == 1);
+  Pass &= (S.Frames + Dropped == Captures) && (Dropped == 1) && (S.JitterFrames == S.Frames - 1);
+  float Jitter = sqrt((S.JitterSqSum - (double)S.JitterMax * S.JitterMax) / (S.JitterFrames - 1));   //Without the late frame
+  Pass &= (Jitter < 1000) && (S.JitterMax >= 250000 - Period) && (S.JitterMax < 250000 - Period + 1000);
+  InitializeFrameScheduler(&S, 24, Period, 0);
+  Dropped = SimulateFrames(&S, Captures, 100, 1000000, -1, 0);
+  Pass &= (S.Starved == 1) && (S.Missed == 0) && (S.Skipped == 0) && (Dropped == 0);
+  Pass &= (S.Frames == (unsigned long)Captures) && (S.JitterFrames == S.Frames - 2) && (S.JitterMax < 1000);
+  SELFTEST_PRINTF("%-24s jitter %.0f us, with a stall %.0f us %s\n", "frame scheduler", Jitter, FrameJitterRms(&S), Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to time rfft, the check fails if a transform takes longer than SELFTEST_PERF_LIMIT_NS.
+*   Input: None.
+*   Output: None.
+*/
+static void TestPerformance(){
+  fft_config_t Config;
+  int n = (SELFTEST_PERF_SIZE < SELFTEST_MAX_SIZE)? SELFTEST_PERF_SIZE : SELFTEST_MAX_SIZE;
+  fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+  FillRandom(In, n);
+  rfft(In, Out, Twiddle, n);                     //Warm up the caches
+  unsigned long Start = SelfTestMicros();
+  for(int i = 0; i < SELFTEST_PERF_RUNS; i++){
+    rfft(In, Out, Twiddle, n);
+  }
+  unsigned long Elapsed = SelfTestMicros() - Start;
+  double NsPerTransform = Elapsed * 1000.0 / SELFTEST_PERF_RUNS;
+  bool Pass = NsPerTransform <= SELFTEST_PERF_LIMIT_NS;
+  SELFTEST_PRINTF("%-24s %.0f ns per transform (n = %d, limit %d) %s\n", "rfft time", NsPerTransform, n, SELFTEST_PERF_LIMIT_NS, Pass? "PASS" : "FAIL");
+  if(!Pass){
+    Failures++;
+  }
+}
+
+/*
+*   Function to time the size-specialized split-radix FFT against the recursive one, the complex
+*   transform inside rfft for every real size. Only printed, there is no limit.
+*   Input: None.
+*   Output: None.
+*/
+static void CompareCodelets(){
+  fft_config_t Config;
+  for(int n = 32; n <= SELFTEST_MAX_SIZE; n *= 2){
+    fft_init_static(&Config, Twiddle, n, FFT_REAL, FFT_FORWARD, In, Out);
+    FillRandom(In, n);
+    int Runs = SELFTEST_PERF_RUNS * SELFTEST_PERF_SIZE / n;
+    unsigned long Elapsed[2];
+    for(int k = 0; k < 2; k++){
+      ComplexKernel Kernel = (k == 0)? split_radix_fft : split_radix_fft_fixed;
+      Kernel(In, Out, n / 2, 2, Twiddle, 4);     //Warm up the caches
+      unsigned long Start = SelfTestMicros();
+      for(int i = 0; i < Runs; i++){
+        Kernel(In, Out, n / 2, 2, Twiddle, 4);
+      }
+      Elapsed[k] = SelfTestMicros() - Start;
+    }
+    SELFTEST_PRINTF("%-24s n = %4d: recursive %.0f ns, fixed %.0f ns, %.2fx\n", "split-radix codelets", n,
+                    Elapsed[0] * 1000.0 / Runs, Elapsed[1] * 1000.0 / Runs, (Elapsed[1] > 0)? (double)Elapsed[0] / Elapsed[1] : 0.0);
+  }
+}
+
+/*
+*   Function to run every FFT check and print the outcome of each.
+*   Input: None.
+*   Output: int - Number of checks that failed, 0 if all passed.
+*/
+int RunFFTSelfTest(){
+  Failures = 0;
+  Seed = 12345;
+  In = (float *)malloc(2 * SELFTEST_MAX_SIZE * sizeof(float));
+  Out = (float *)malloc(2 * SELFTEST_MAX_SIZE * sizeof(float));
+  Ref = (float *)malloc(2 * SELFTEST_MAX_SIZE * sizeof(float));
+  Twiddle = (float *)malloc(2 * SELFTEST_MAX_SIZE * sizeof(float));
+  RefTwiddle = (float *)malloc(2 * SELFTEST_MAX_SIZE * sizeof(float));
+  Masks = (unsigned char *)malloc(SELFTEST_MAX_SIZE);
+  BitReverse = (unsigned short *)malloc(SELFTEST_MAX_SIZE * sizeof(unsigned short));
+  if(In == NULL || Out == NULL || Ref == NULL || Twiddle == NULL || RefTwiddle == NULL || Masks == NULL || BitReverse == NULL){
+    SELFTEST_PRINTF("FFT self test: not enough memory\n");
+    Failures = 1;
+  }
+  else{
+    SELFTEST_PRINTF("FFT self test (USE_SPLIT_RADIX %d, LARGE_BASE_CASE %d, USE_FFT_CODELETS %d)\n", USE_SPLIT_RADIX, LARGE_BASE_CASE, USE_FFT_CODELETS);
+    TestBaseCases();
+    TestCodelets();
+    TestComplexKernel("split_radix_fft", split_radix_fft);
+    TestComplexKernel("split_radix_fft_fixed", split_radix_fft_fixed);
+    TestComplexKernel("fft_primitive", fft_primitive);
+    TestRealFFT();
+    TestPrunedFFT();
+    TestInPlaceFFT();
+    TestFilterEngine();
+    TestPowerGovernor();
+    TestPeakPicker();
+    TestSignalGenerator();
+    TestTriggerEngine();
+    TestLatencyMonitor();
+    TestEventRecorder();
+    TestPitchDetector();
+    TestFrameScheduler();
+    TestPerformance();
+    CompareCodelets();
+    SELFTEST_PRINTF("FFT self test: %d checks failed\n", Failures);
+  }
+  free(In);
+  free(Out);
+  free(Ref);
+  free(Twiddle);
+  free(RefTwiddle);
+  free(Masks);
+  free(BitReverse);
+  return Failures;
+}
+
+#ifndef ARDUINO
+int main(){
+  return RunFFTSelfTest();
+}
+#endif
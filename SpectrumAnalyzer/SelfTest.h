@@ -0,0 +1,40 @@
+/*
+    * SelfTest.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the self test of the FFT kernels in FFT.h,
+    *  of the filter engine built on them, of the power governor logic,
+    *  of the peak picker, of the synthetic signal sources, of the trigger,
+    *  of the latency histogram, of the event recorder, of the pitch detector
+    *  and of the frame scheduler.
+    *  SelfTest.cpp does not depend on the ESP32, so the same checks run
+    *  on a PC as well:
+    *    g++ -O2 -o selftest SelfTest.cpp FilterEngine.cpp PowerGovernor.cpp PeakPicker.cpp SignalGenerator.cpp TriggerEngine.cpp LatencyMonitor.cpp EventRecorder.cpp PitchDetector.cpp FrameScheduler.cpp && ./selftest
+    *    g++ -O2 -DUSE_SPLIT_RADIX=0 -DLARGE_BASE_CASE=0 -o selftest SelfTest.cpp FilterEngine.cpp PowerGovernor.cpp PeakPicker.cpp SignalGenerator.cpp TriggerEngine.cpp LatencyMonitor.cpp EventRecorder.cpp PitchDetector.cpp FrameScheduler.cpp && ./selftest
+    *    g++ -Os -DUSE_FFT_CODELETS=0 -o selftest SelfTest.cpp FilterEngine.cpp PowerGovernor.cpp PeakPicker.cpp SignalGenerator.cpp TriggerEngine.cpp LatencyMonitor.cpp EventRecorder.cpp PitchDetector.cpp FrameScheduler.cpp && ./selftest
+    *  
+*/
+#ifndef _SELFTEST_H
+#define _SELFTEST_H
+
+//Defines
+#ifndef SELFTEST_MAX_SIZE
+#define SELFTEST_MAX_SIZE 1024                  //Largest real FFT that is checked, every power of two below it is checked as well
+#endif
+#define SELFTEST_TOLERANCE 1e-4                 //Largest error allowed, relative to the largest output value
+#define SELFTEST_EVENT_SAMPLES 256              //Samples of every capture of the event recorder check
+#define SELFTEST_EVENT_RING 1024                //Bytes of its ring, a few captures, so it wraps
+#define SELFTEST_PITCH_CENTS 10                 //Largest error of a detected note(cents)
+#define SELFTEST_PERF_SIZE 1024                 //Size of the real FFT that is timed
+#define SELFTEST_PERF_RUNS 200                  //Number of transforms the time is averaged over
+#ifndef SELFTEST_PERF_LIMIT_NS
+#ifdef ARDUINO
+#define SELFTEST_PERF_LIMIT_NS 400000           //The timed FFT fails if it takes longer than this(ns per transform)
+#else
+#define SELFTEST_PERF_LIMIT_NS 40000
+#endif
+#endif
+
+//Function Prototypes
+int RunFFTSelfTest();
+#endif //_SELFTEST_H
@@ -0,0 +1,146 @@
+/*
+*   SignalGenerator.cpp
+*   Created on: Oct 19, 2026
+*   Synthetic signal sources, used in place of the ADC by the benchmarks and tests.
+*/
+#include "SignalGenerator.h"
+#include <math.h>
+
+//Tones of SIGNAL_MULTITONE, each gets an equal share of the amplitude
+static const float SignalMultiTone[] = {220.0, 440.0, 1000.0, 2500.0, 4000.0};
+static const int SignalMultiToneCount = sizeof(SignalMultiTone) / sizeof(SignalMultiTone[0]);
+
+//Functions
+
+/*
+*   Function to set up a signal source.
+*   Input: SignalGenerator *Gen - The source to set up.
+*   Input: SignalType Type - The kind of signal.
+*   Input: float SampleRate - Samples per second.
+*   Input: float Frequency - Frequency of the sine, start frequency of the chirp.
+*   Input: float FrequencyEnd - End frequency of the chirp, not used by the others.
+*   Input: float Amplitude - Peak amplitude in ADC counts.
+*   Output: None.
+*/
+void InitializeSignalGenerator(SignalGenerator *Gen, SignalType Type, float SampleRate, float Frequency, float FrequencyEnd, float Amplitude){
+  Gen->Type = Type;
+  Gen->SampleRate = SampleRate;
+  Gen->Frequency = Frequency;
+  Gen->FrequencyEnd = FrequencyEnd;
+  Gen->Amplitude = Amplitude;
+  Gen->Period = SIGNAL_IMPULSE_PERIOD;
+  Gen->Sample = 0;
+  Gen->Phase = 0;
+  Gen->Seed = 22222;
+  for(int i = 0; i < 7; i++){
+    Gen->Pink[i] = 0;
+  }
+}
+
+/*
+*   Function to get white noise.
+*   Input: SignalGenerator *Gen - The source, its seed is advanced.
+*   Output: float - A value between -1 and 1.
+*/
+static float WhiteNoise(SignalGenerator *Gen){
+  Gen->Seed = Gen->Seed * 1664525u + 1013904223u;
+  return (Gen->Seed >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+/*
+*   Function to get the next sample of a source.
+*   Input: SignalGenerator *Gen - The source.
+*   Output: float - The sample, relative to SIGNAL_MID_LEVEL, in ADC counts.
+*/
+float NextSignalSample(SignalGenerator *Gen){
+  float Value = 0;
+  double t = Gen->Sample / (double)Gen->SampleRate;
+  switch(Gen->Type){
+    case SIGNAL_SINE:
+      Value = sin(2 * M_PI * Gen->Phase);
+      Gen->Phase += Gen->Frequency / Gen->SampleRate;
+      break;
+    case SIGNAL_MULTITONE:
+      for(int i = 0; i < SignalMultiToneCount; i++){
+        Value += sin(2 * M_PI * SignalMultiTone[i] * t);
+      }
+      Value /= SignalMultiToneCount;
+      break;
+    case SIGNAL_CHIRP:{
+      //The frequency rises linearly and jumps back to the start every SIGNAL_CHIRP_SECONDS.
+      float Sweep = fmod(t, SIGNAL_CHIRP_SECONDS) / SIGNAL_CHIRP_SECONDS;
+      Value = sin(2 * M_PI * Gen->Phase);
+      Gen->Phase += (Gen->Frequency + (Gen->FrequencyEnd - Gen->Frequency) * Sweep) / Gen->SampleRate;
+      break;
+    }
+    case SIGNAL_WHITE_NOISE:
+      Value = WhiteNoise(Gen);
+      break;
+    case SIGNAL_PINK_NOISE:{
+      //Paul Kellet's filter, white noise through a set of first order low passes.
+      float White = WhiteNoise(Gen);
+      float *b = Gen->Pink;
+      b[0] = 0.99886 * b[0] + White * 0.0555179;
+      b[1] = 0.99332 * b[1] + White * 0.0750759;
+      b[2] = 0.96900 * b[2] + White * 0.1538520;
+      b[3] = 0.86650 * b[3] + White * 0.3104856;
+      b[4] = 0.55000 * b[4] + White * 0.5329522;
+      b[5] = -0.7616 * b[5] - White * 0.0168980;
+      Value = (b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + White * 0.5362) * 0.11;
+      b[6] = White * 0.115926;
+      break;
+    }
+    case SIGNAL_IMPULSE:
+      Value = (Gen->Sample % Gen->Period == 0)? 1.0 : 0.0;
+      break;
+    default:
+      break;
+  }
+  //Keep the phase small so it does not lose precision over a long run.
+  if(Gen->Phase >= 1.0){
+    Gen->Phase -= floor(Gen->Phase);
+  }
+  Gen->Sample++;
+  return Value * Gen->Amplitude;
+}
+
+/*
+*   Function to fill a buffer with raw i2s words, as the ADC would.
+*   The ADC puts its channel in bits 15:12 and the 12 bit value below that. ConvertSampledData()
+*   turns a raw value r into r + 1, so 1 is taken off here to get back the value of the source.
+*   Input: SignalGenerator *Gen - The source.
+*   Input: int16_t *Raw - The buffer to fill.
+*   Input: int Count - Number of samples to make.
+*   Input: int Stride - Words between two samples, 2 to interleave two sources for DUAL_CHANNEL.
+*   Input: int Tag - ADC channel written into the upper 4 bits.
+*   Output: None.
+*/
+void GenerateRawSamples(SignalGenerator *Gen, int16_t *Raw, int Count, int Stride, int Tag){
+  for(int i = 0; i < Count; i++){
+    long Value = lrintf(SIGNAL_MID_LEVEL + NextSignalSample(Gen)) - 1;
+    if(Value < 0){
+      Value = 0;
+    }
+    else if(Value > SIGNAL_ADC_MAX){
+      Value = SIGNAL_ADC_MAX;
+    }
+    Raw[i * Stride] = (int16_t)((Tag << 12) | Value);
+  }
+}
+
+/*
+*   Function to get the name of a source, used in the reports.
+*   Input: SignalType Type - The kind of signal.
+*   Output: const char * - Its name.
+*/
+const char *SignalTypeName(SignalType Type){
+  switch(Type){
+    case SIGNAL_SINE:        return "sine";
+    case SIGNAL_MULTITONE:   return "multitone";
+    case SIGNAL_CHIRP:       return "chirp";
+    case SIGNAL_WHITE_NOISE: return "white_noise";
+    case SIGNAL_PINK_NOISE:  return "pink_noise";
+    case SIGNAL_IMPULSE:     return "impulse";
+    default:                 return "unknown";
+  }
+}
@@ -0,0 +1,51 @@
+/*
+    * SignalGenerator.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the synthetic signal sources. They make the same
+    *  raw i2s words the ADC does, so everything after the i2s driver can be
+    *  fed with a known signal. Does not depend on the ESP32.
+    *  
+*/
+#ifndef _SIGNALGENERATOR_H
+#define _SIGNALGENERATOR_H
+
+#include <stdint.h>
+
+//Defines
+#define SIGNAL_MID_LEVEL 2048                   //ADC value of a silent input, the signals swing around it
+#define SIGNAL_ADC_MAX 4095                     //Largest ADC value, the signals are clipped to 0 - SIGNAL_ADC_MAX
+#define SIGNAL_CHIRP_SECONDS 2.0                //Time the chirp takes to sweep from Frequency to FrequencyEnd
+#define SIGNAL_IMPULSE_PERIOD 1024              //Samples between two impulses, unless Period is changed after InitializeSignalGenerator()
+
+//The available sources
+enum SignalType{
+  SIGNAL_SINE,                                  //Sine at Frequency
+  SIGNAL_MULTITONE,                             //Sum of the tones in SignalMultiTone[]
+  SIGNAL_CHIRP,                                 //Linear sweep from Frequency to FrequencyEnd, then starts over
+  SIGNAL_WHITE_NOISE,
+  SIGNAL_PINK_NOISE,                            //Noise falling 3dB per octave
+  SIGNAL_IMPULSE,                               //One sample at full Amplitude every Period samples
+  SIGNAL_TYPE_COUNT
+};
+
+//State of one source
+struct SignalGenerator{
+  SignalType Type;
+  float SampleRate;                             //Samples per second
+  float Frequency;                              //Frequency of the sine, start of the chirp
+  float FrequencyEnd;                           //End of the chirp
+  float Amplitude;                              //Peak amplitude in ADC counts
+  unsigned long Period;                         //Samples between two impulses
+  unsigned long Sample;                         //Number of samples made so far
+  double Phase;                                 //Phase of the sine and chirp, in cycles
+  uint32_t Seed;                                //State of the noise generator
+  float Pink[7];                                //State of the pink noise filter
+};
+
+//Function Prototypes
+void InitializeSignalGenerator(SignalGenerator *Gen, SignalType Type, float SampleRate, float Frequency, float FrequencyEnd, float Amplitude);
+float NextSignalSample(SignalGenerator *Gen);
+void GenerateRawSamples(SignalGenerator *Gen, int16_t *Raw, int Count, int Stride, int Tag);
+const char *SignalTypeName(SignalType Type);
+#endif //_SIGNALGENERATOR_H
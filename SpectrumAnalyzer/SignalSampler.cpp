@@ -6,27 +6,50 @@
 */
 
 #include "SignalSampler.h"
+#include "MemoryArena.h"
+#include "DisplayFunctions.h"
+
+static_assert(ADC_CHANNEL_USED == ADC_CHANNEL_TAG && AUX_ADC_CHANNEL_USED == AUX_ADC_CHANNEL_TAG, "The conversion splits the i2s words by these tags");
+
+//Define the global variables
+QueueHandle_t i2s_event_queue = NULL;
+static int16_t *RawSamples = NULL;                    //i2s read buffer, carved from the arena in ADCSetup()
 
 //Functions
 
+/*
+*   Function to wait for the DMA to complete a buffer.
+*   Blocks on the i2s event queue, so the calling task sleeps (and the watchdog gets fed by
+*   the idle task) instead of polling or delaying. Other events (queue overflow etc.) are skipped.
+*   With DUAL_CHANNEL a frame spans I2S_BUFFERS_PER_FRAME buffers, this waits for all of them.
+*   Input: None.
+*   Output: unsigned long - micros() when the last buffer was done, the time of the newest sample of the capture.
+*/
+unsigned long WaitForSampledData(){
+    i2s_event_t i2s_event;
+    for(int i = 0; i < I2S_BUFFERS_PER_FRAME; i++){
+        do{
+            xQueueReceive(i2s_event_queue, &i2s_event, portMAX_DELAY);
+        }while(i2s_event.type != I2S_EVENT_RX_DONE);
+    }
+    return micros();
+}
 
 /*
 *   Function to get the sampled data.
+*   Call WaitForSampledData() first, the completed buffer is then already there so this does not block.
 *   Input: double* AnalogValue_re - Reference to the array to store the sampled data.
+*   Input: double* AuxValue_re - Reference to the array to store the sampled data of the AUX input (only with DUAL_CHANNEL).
+*   Input: SignalGenerator *Source - If not NULL the main input is replaced by this source. The DMA is still read, so the captures keep their timing.
+*   Input: SignalGenerator *AuxSource - Same for the AUX input, only with DUAL_CHANNEL.
 *   Return: Average of the sampled data.
 */
-double GetSampledData(float* AnalogValue_re){
+double GetSampledData(float* AnalogValue_re, float* AuxValue_re, SignalGenerator *Source, SignalGenerator *AuxSource){
     unsigned long timee = micros();
-    double avg = 0; 
     size_t bytes_read = 0;
-    int16_t* buffer = (int16_t*)malloc(BUFFER_SIZE * sizeof(int16_t));
-    if (buffer == NULL) {
-        Serial.println("Failed to allocate memory");
-        while(1);
-    }
+    int16_t* buffer = RawSamples;
     //Read data from the ADC
-    i2s_read(I2S_NUM_0, buffer, sizeof(int16_t)* BUFFER_SIZE, &bytes_read, portMAX_DELAY);
-    i2s_adc_disable(I2S_NUM_0); //Disable ADC
+    i2s_read(I2S_NUM_0, buffer, sizeof(int16_t)* BUFFER_SIZE * ADC_CHANNEL_COUNT, &bytes_read, portMAX_DELAY);
 
     int samplesRead = bytes_read / sizeof(int16_t);
     
@@ -35,28 +58,52 @@ double GetSampledData(float* AnalogValue_re){
         sprintf(Stringbuff, "Read %d bytes out of %d bytes", samplesRead, BUFFER_SIZE);
         //Serial.println(Stringbuff);
     }
-    
-    //Now copy the data into the output data array
-    for(int i = 0; i < BUFFER_SIZE; i++){
-        buffer[i] = (int)ADC_CHANNEL_USED * 0x1000 + 0xFFF - buffer[i];     //Some Voodoo magic to get the correct value, I think it to convert the output format of i2s. Found online.
-        AnalogValue_re[i] = 4096.0 - buffer[i];                             //The value needs to be substracted from 4096 to get the correct value. (i.e the one read from AnalogRead())
-        avg += AnalogValue_re[i];
-        //Serial.printf("Value %d: ", i);
-        //Serial.println(4095-buffer[i]);
-    }
 
-    free(buffer);   //Free the memory allocated for the buffer
-    avg /= BUFFER_SIZE;
+    if(Source != NULL){
+        GenerateRawSamples(Source, buffer, BUFFER_SIZE, ADC_CHANNEL_COUNT, ADC_CHANNEL_USED);
+    }
+    if(DUAL_CHANNEL && AuxSource != NULL){
+        GenerateRawSamples(AuxSource, buffer + 1, BUFFER_SIZE, ADC_CHANNEL_COUNT, AUX_ADC_CHANNEL_USED);
+    }
+    double avg = ConvertSampledData(buffer, AnalogValue_re, AuxValue_re);
 
     //Stuff to do with the time taken to sample the data will be deleted later
     timee = micros() - timee;
     //Serial.print("ReadTime: ");
     //Serial.println(timee);
 
-    i2s_adc_enable(I2S_NUM_0);  //Enable the ADC again
     return avg; //return average value
 }
 
+/*
+*   Function to set up the synthetic sources for the inputs, the same way PipelineBenchmark feeds them:
+*   the sine at SYNTHETIC_FREQ(1.5 times that on the AUX input) and the chirp over the FFT plot.
+*   Input: int Type - A SignalType.
+*   Input: SignalGenerator *Source - Source of the main input.
+*   Input: SignalGenerator *AuxSource - Source of the AUX input.
+*   Output: None.
+*/
+void SelectSyntheticSource(int Type, SignalGenerator *Source, SignalGenerator *AuxSource){
+    float Start = (Type == SIGNAL_CHIRP)? FFTPLOT_FREQ_START : SYNTHETIC_FREQ;
+    InitializeSignalGenerator(Source, (SignalType)Type, ReadFreq, Start, FFTPLOT_FREQ_END, SYNTHETIC_AMPLITUDE);
+    InitializeSignalGenerator(AuxSource, (SignalType)Type, ReadFreq, (Type == SIGNAL_CHIRP)? Start : 1.5 * SYNTHETIC_FREQ, FFTPLOT_FREQ_END, SYNTHETIC_AMPLITUDE);
+    AuxSource->Seed = 33333;                           //Noise on the two inputs is not the same
+}
+
+/*
+*   Function to throw away a completed DMA buffer.
+*   Used when there is no free frame to store the samples in, so the i2s driver does not fall behind.
+*   Input: None.
+*   Output: None.
+*/
+void DiscardSampledData(){
+    int16_t buffer[128];
+    size_t bytes_read = 0;
+    for(int i = 0; i < BUFFER_SIZE * ADC_CHANNEL_COUNT; i += 128){
+        i2s_read(I2S_NUM_0, buffer, sizeof(buffer), &bytes_read, portMAX_DELAY);
+    }
+}
+
 /*
 *   Function to initialize the ADC.
 *   Initializes ADC and i2s DMA writing.
@@ -68,23 +115,25 @@ void ADCSetup(Stream &Serial){
 
     Serial.println("Initializing ADC...");
 
+    RawSamples = (int16_t *)ArenaAlloc(ARENA_BUDGET_RAW_SAMPLES, "i2s read buffer", ARENA_SAMPLES);
+
     // Cofiguring the i2s driver for ADC
     i2s_config_t i2s_config = {
         .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN),
-        .sample_rate = ReadFreq,
+        .sample_rate = ReadFreq * ADC_CHANNEL_COUNT,      //Every channel is sampled at ReadFreq
         .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
         .channel_format = I2S_CHANNEL_FMT_ONLY_RIGHT,
         .communication_format = I2S_COMM_FORMAT_I2S_LSB,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1, // high interrupt priority
-        .dma_buf_count = 4,
+        .dma_buf_count = I2S_DMA_BUF_COUNT,
         .dma_buf_len = BUFFER_SIZE,
         .use_apll = false,
         .tx_desc_auto_clear = false,
         .fixed_mclk = 0
     };
 
-    //Configure i2s driver
-    err = i2s_driver_install(I2S_NUM_0, &i2s_config, 0, NULL);
+    //Configure i2s driver, the event queue is used to wake the processing task on every completed DMA buffer
+    err = i2s_driver_install(I2S_NUM_0, &i2s_config, I2S_EVENT_QUEUE_LEN, &i2s_event_queue);
     if (err != ESP_OK) {
         Serial.println("Failed installing i2s driver");
         while(1);
@@ -103,37 +152,222 @@ void ADCSetup(Stream &Serial){
         while(1);
     }
 
+    //The driver only knows one channel. For the AUX input, add a second entry to the SAR ADC pattern
+    //table so the ADC alternates between the two. i2s_adc_enable() rewrites the table, so this comes after it.
+    //Each entry is 8 bits, channel[7:4] width[3:2] attenuation[1:0], the first entry is the top byte.
+    if(DUAL_CHANNEL){
+        uint32_t Entry = (SYSCON.saradc_sar1_patt_tab[0] >> 24) & 0xFF;
+        uint32_t AuxEntry = (AUX_ADC_CHANNEL_USED << 4) | (Entry & 0x0F);     //Same width and attenuation as the first channel
+        SYSCON.saradc_sar1_patt_tab[0] = (Entry << 24) | (AuxEntry << 16);
+        SYSCON.saradc_ctrl.sar1_patt_len = ADC_CHANNEL_COUNT - 1;            //The length is stored minus one
+        Serial.println("AUX channel added to the ADC pattern");
+    }
+
     Serial.println("ADC initialized");
 }
 
 /*
-*   Function to compute the FFT of the sampled data.
-*   Input: Pointer to FFT Config - to compute the FFT.
-*   Input: Float array of predefined length (BufferSize/2 - 1) to store magnitude data
-*   Output: Returns the frequency with maximum magnitude.
-*/
-float ComputeFFT(fft_config_t *FFT, float *Magnitude){
-//    FFT.DCRemoval();
-//    FFT.Windowing(FFT_WIN_TYP_HAMMING, FFT_FORWARD);
-//    FFT.Compute(FFT_FORWARD);
-//    FFT.ComplexToMagnitude();
-    fft_execute(FFT);    //Do fft.
-
-    //Serial.println("FFT Done");
-    //Now get magnitude and Major Frequency
-    float max_magnitude = 0.0;
-    float major_freq = 0.0;
-    for(int i = 1; i < FFT->size/2; i++){
-      Magnitude[i-1] = sqrt(pow(FFT->output[2*i], 2) + pow(FFT->output[2*i+1],2))/1;
-      float freq = i * 1/(BUFFER_SIZE*1.0/ReadFreq);
-      if(Magnitude[i-1] > max_magnitude){
-        max_magnitude = Magnitude[i-1];
-        major_freq = freq;
+*   Function to initialize the I2S output for the filtered signal.
+*   The built in DAC only works on I2S0, which the ADC already uses, so the output goes to an
+*   external I2S DAC on I2S1 at the same sample rate. Both channels get the same signal.
+*   Input: Handle to the Serial object.
+*   Output: None.
+*/
+void FilterOutputSetup(Stream &Serial){
+    esp_err_t err;
+
+    Serial.println("Initializing filter output...");
+
+    i2s_config_t i2s_config = {
+        .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX),
+        .sample_rate = ReadFreq,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
+        .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
+        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+        .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
+        .dma_buf_count = FILTER_I2S_DMA_BUF_COUNT,
+        .dma_buf_len = FILTER_BLOCK,
+        .use_apll = false,
+        .tx_desc_auto_clear = true,                     //Silence instead of the old samples if a frame is late
+        .fixed_mclk = 0
+    };
+    i2s_pin_config_t pin_config = {
+        .mck_io_num = I2S_PIN_NO_CHANGE,
+        .bck_io_num = FILTER_I2S_BCK_PIN,
+        .ws_io_num = FILTER_I2S_WS_PIN,
+        .data_out_num = FILTER_I2S_DATA_PIN,
+        .data_in_num = I2S_PIN_NO_CHANGE
+    };
+
+    err = i2s_driver_install(I2S_NUM_1, &i2s_config, 0, NULL);
+    if (err != ESP_OK) {
+        Serial.println("Failed installing i2s output driver");
+        while(1);
+    }
+    err = i2s_set_pin(I2S_NUM_1, &pin_config);
+    if (err != ESP_OK) {
+        Serial.println("Failed setting i2s output pins");
+        while(1);
+    }
+    Serial.println("Filter output initialized");
+}
+
+/*
+*   Function to design the filter picked by FILTER_KIND and set up the engine for it.
+*   The buffers of the engine are carved from the arena.
+*   Input: FilterEngine *Filter - The engine to set up.
+*   Output: FilterEngine * - The engine.
+*/
+FilterEngine *InitializeFilter(FilterEngine *Filter){
+    float Taps[FILTER_TAPS];                            //Only needed until the spectrum of the filter is worked out
+    const float BandFreqs[] = FILTER_EQ_FREQS;
+    const float BandGainsDb[] = FILTER_EQ_GAINS_DB;
+    if(FILTER_KIND == FILTER_EQUALIZER){
+        DesignEqualizer(Taps, FILTER_TAPS, BandFreqs, BandGainsDb, sizeof(BandFreqs)/sizeof(BandFreqs[0]), ReadFreq);
+    }
+    else{
+        DesignBandFilter(Taps, FILTER_TAPS, FILTER_FREQ_LOW, FILTER_FREQ_HIGH, ReadFreq, FILTER_KIND == FILTER_NOTCH);
+    }
+    float *Buffer = (float *)ArenaAlloc(ARENA_BUDGET_FILTER, "FIR filter", ARENA_SAMPLES);
+    return InitializeFilterEngine(Filter, Buffer, Taps, FILTER_TAPS);
+}
+
+/*
+*   Function to play the filtered samples of a frame on the I2S DAC.
+*   Does not wait, if the DMA buffers are still full (a frame came early) the rest of the frame is dropped.
+*   Input: const float *Samples - The filtered samples, BUFFER_SIZE of them.
+*   Input: double Average - Mid scale of the samples, becomes 0 at the output.
+*   Output: None.
+*/
+void WriteFilteredData(const float *Samples, double Average){
+    static int16_t Stereo[2 * FILTER_BLOCK];
+    for(int b = 0; b < BUFFER_SIZE; b += FILTER_BLOCK){
+        for(int i = 0; i < FILTER_BLOCK; i++){
+            float Value = (Samples[b + i] - Average) * FILTER_OUTPUT_GAIN;
+            Value = (Value > 32767)? 32767 : ((Value < -32768)? -32768 : Value);
+            Stereo[2*i] = Stereo[2*i + 1] = (int16_t)Value;
+        }
+        size_t bytes_written = 0;
+        i2s_write(I2S_NUM_1, Stereo, sizeof(Stereo), &bytes_written, 0);
+        if(bytes_written < sizeof(Stereo)){
+            break;
+        }
+    }
+}
+
+/*
+*   Function to set up the FFT without touching the heap.
+*   The configuration and the twiddle factors are carved from the arena.
+*   Input: float *Input - FFT input buffer of BUFFER_SIZE floats.
+*   Input: float *Output - FFT output buffer of BUFFER_SIZE floats.
+*   Output: fft_config_t * - The FFT configuration.
+*/
+fft_config_t *InitializeFFT(float *Input, float *Output){
+    fft_config_t *config = (fft_config_t *)ArenaAlloc(ARENA_BUDGET_FFT_CONFIG, "FFT config", ARENA_FFT);
+    float *twiddle_factors = (float *)ArenaAlloc(ARENA_BUDGET_TWIDDLES, "Twiddle factors", ARENA_FFT);
+    return fft_init_static(config, twiddle_factors, BUFFER_SIZE, FFT_REAL, FFT_FORWARD, Input, Output);
+}
+
+/*
+*   Function to plan the FFT so it only computes the bins that end up on the display.
+*   The masks of the plan are carved from the arena.
+*   Input: fft_config_t *FFT - The FFT to prune, its twiddle factors are shared.
+*   Input: int BinStart - First bin to compute.
+*   Input: int BinEnd - Last bin to compute.
+*   Input: fft_pruned_plan_t *Plan - Plan to fill in. NULL to carve a new one out of the arena.
+*   Output: fft_pruned_plan_t * - The plan.
+*/
+fft_pruned_plan_t *InitializePrunedFFT(fft_config_t *FFT, int BinStart, int BinEnd, fft_pruned_plan_t *Plan){
+    static unsigned char *Masks = NULL;   //All plans share one mask buffer, only the last one planned is valid.
+    if(Masks == NULL){
+        Masks = (unsigned char *)ArenaAlloc(ARENA_BUDGET_PRUNE_MASKS, "Pruned FFT masks", ARENA_FFT);
+    }
+    if(Plan == NULL){
+        Plan = (fft_pruned_plan_t *)ArenaAlloc(sizeof(fft_pruned_plan_t), "Pruned FFT plan", ARENA_FFT);
+    }
+    return rfft_pruned_init(Plan, Masks, FFT->twiddle_factors, FFT->size, BinStart, BinEnd);
+}
+
+/*
+*   Function to compute the FFT of two real signals with one complex FFT.
+*   Signal A goes into the real part and B into the imaginary part of the input. With Z the FFT of that,
+*   A[k] = (Z[k] + conj(Z[N-k])) / 2 and B[k] = (Z[k] - conj(Z[N-k])) / 2j.
+*   Input: fft_config_t *FFT - FFT config of size N, only its twiddle factors are used.
+*   Input: float *InputA, *InputB - The two signals, N samples each.
+*   Input: float *Packed - Scratch space of 2N floats, the complex FFT runs in place there.
+*   Input: const unsigned short *BitReverse, int Pairs - The permutation of a size N FFT, from fft_bitrev_init().
+*   Input: float *OutputA, *OutputB - N floats each, the spectra in the same layout as rfft
+*          ([0] DC, [1] centre, then real/imaginary pairs for bins 1 to N/2 - 1).
+*   Output: None.
+*/
+void ComputeDualFFT(fft_config_t *FFT, float *InputA, float *InputB, float *Packed, const unsigned short *BitReverse, int Pairs, float *OutputA, float *OutputB){
+    int N = FFT->size;
+    for(int i = 0; i < N; i++){
+      Packed[2*i] = InputA[i];
+      Packed[2*i+1] = InputB[i];
+    }
+    fft_inplace(Packed, N, FFT->twiddle_factors, 2, BitReverse, Pairs);
+
+    float *Z = Packed;
+    OutputA[0] = Z[0];    OutputA[1] = Z[N];        //DC and centre are purely real
+    OutputB[0] = Z[1];    OutputB[1] = Z[N+1];
+    for(int k = 1; k < N/2; k++){
+      float zr = Z[2*k],       zi = Z[2*k+1];
+      float wr = Z[2*(N-k)],   wi = Z[2*(N-k)+1];
+      OutputA[2*k]   = 0.5 * (zr + wr);
+      OutputA[2*k+1] = 0.5 * (zi - wi);
+      OutputB[2*k]   = 0.5 * (zi + wi);
+      OutputB[2*k+1] = 0.5 * (wr - zr);
+    }
+}
+
+/*
+*   Function to measure the pruned FFT against the full rfft at several band widths, and the in-place rfft.
+*   Uses the FFT buffers and the shared mask buffer, so it must run before the pipeline plan is made.
+*   Input: Stream &Serial - Reference to the Serial object.
+*   Input: fft_config_t *FFT - The FFT to measure.
+*   Output: None.
+*/
+void BenchmarkPrunedFFT(Stream &Serial, fft_config_t *FFT){
+    const int Repeats = 200;
+    const int Widths[] = {BUFFER_SIZE/2, 420, 256, 128, 64, 32, 16};
+    fft_pruned_plan_t Plan;
+
+    for(int i = 0; i < FFT->size; i++){
+      FFT->input[i] = 2048.0 + 1000.0 * sinf(i * 0.3) + 200.0 * sinf(i * 1.7);
+    }
+    unsigned long timee = micros();
+    for(int r = 0; r < Repeats; r++){
+      rfft(FFT->input, FFT->output, FFT->twiddle_factors, FFT->size);
+    }
+    float FullUs = (micros() - timee) * 1.0 / Repeats;
+
+    Serial.println("----Pruned FFT Benchmark----");
+    Serial.printf("Full rfft: %.1f us\n", FullUs);
+    //The in-place rfft needs no output buffer, it is timed on the output buffer with a copy of the input.
+    unsigned short *BitReverse = (unsigned short *)malloc(FFT->size / 2 * sizeof(unsigned short));
+    if(BitReverse != NULL){
+      int Pairs = fft_bitrev_init(BitReverse, FFT->size / 2);
+      timee = micros();
+      for(int r = 0; r < Repeats; r++){
+        memcpy(FFT->output, FFT->input, FFT->size * sizeof(float));
+        rfft_inplace(FFT->output, FFT->twiddle_factors, FFT->size, BitReverse, Pairs);
       }
-      FFT->output[i] = Magnitude[i - 1];
+      Serial.printf("In-place rfft (with the copy): %.1f us\n", (micros() - timee) * 1.0 / Repeats);
+      free(BitReverse);
     }
-    
-    return major_freq;
+    for(unsigned w = 0; w < sizeof(Widths)/sizeof(Widths[0]); w++){
+      int BinStart = (Widths[w] == BUFFER_SIZE/2)? 1 : ceil(FFTPLOT_BENCH_FREQ_START * BUFFER_SIZE * 1.0 / ReadFreq);
+      int BinEnd = min(BinStart + Widths[w] - 1, BUFFER_SIZE/2);
+      InitializePrunedFFT(FFT, BinStart, BinEnd, &Plan);
+      timee = micros();
+      for(int r = 0; r < Repeats; r++){
+        rfft_pruned(FFT->input, FFT->output, &Plan);
+      }
+      float PrunedUs = (micros() - timee) * 1.0 / Repeats;
+      Serial.printf("Bins %3d-%3d (%3d): %.1f us, speedup %.2f\n", BinStart, BinEnd, BinEnd - BinStart + 1, PrunedUs, FullUs / PrunedUs);
+    }
+    Serial.println("----Pruned FFT Benchmark Finished----");
 }
 
 /*
@@ -152,55 +386,32 @@ void PrintFFT(Stream &Serial, float *RealValue, int BUFFERSIZE){
 }
 
 /*
-*   Function to prepare the data for the FFT plot.
-*   Input: double* AnalogValue_re - Reference to the array that has the FFT data.
-*   Input: int FreqS - The starting frequency for the plot to consider.
-*   Input: int FreqE - The ending frequency for the plot to consider.
-*   Input: int Channel - The channels in the plot, i.e the number of bars
-*   Input: int SamplFreq - The sampling frequency of the data.
-*   Input: int SamplSize - The size of the FFT sampling Data.
-*   Input: uint32_t* DisplayData - Reference to the array to store the data for the plot. Assumed that the user calls InitializeDisplayArray(int Channel) to get this.
+*   Function to mirror the display data, so the first channel ends up on the right.
+*   Used for the L/R layout, where the left spectrum grows from the centre to the left.
+*   Input: uint32_t* DisplayData - The display data.
+*   Input: int Channel - Number of channels.
 *   Output: None.
 */
-void PrepareDisplayData(float *AnalogValue_re, int FreqS, int FreqE, int Channel, int SamplFreq, int SamplSize, uint32_t *DisplayData){
-    //Firstly Clear Display Buffer
-    ClearDisplayBuffer(DisplayData, Channel);
-    
-    //Variables needed to do the computation
-    //Check how the data is stored after FFT computaition to understand Bins and BinSize
-    int Bins = SamplSize/2;
-    float BinSize = SamplFreq / SamplSize;
-    int BinStart = ceil(FreqS / BinSize);   //The bin to start from, i.e which has the data from the starting frequency.
-    int BinEnd = ceil(FreqE / BinSize);     //The bin to end at, i.e which has the data from the ending frequency.
-    int BinCount = BinEnd - BinStart + 1;
-    int BinIncrement = floor(BinCount/Channel);
-    int DispChannel = 0;                    //Used to fill the display data array.
-    bool Is_Float_Increnment = (BinCount % Channel == 0)? 0 : 1;    //Used to determine if the total bins and channel are completly dvivisible. Otherwise the last channel will have more bins than the others.
-    
-    for(int i = BinStart; i <= BinStart + Channel*BinIncrement; i+=BinIncrement){   //The loop is simple, start the the starting bin and fill the next 'n' bins in the DisplayData[Ch] array position. 
-        if((DispChannel == Channel)&&(Is_Float_Increnment)){    //This part deals with unven number of Bins in case they are present  
-            for(int j = i; j <= BinEnd; j++){
-                DisplayData[DispChannel] += AnalogValue_re[j]/100 - FFT_NOISE_THRESHOLD; 
-            }
-        }
-        for(int j = i; j <= i + BinIncrement - 1; j++){
-            DisplayData[DispChannel] += AnalogValue_re[j];      //The filling takes place here.
-        }
-        DispChannel++;      //One one of the channel is filled, increment the channel.
-    }
+void ReverseDisplayData(uint32_t *DisplayData, int Channel){
+  for(int i = 0; i < Channel/2; i++){
+    uint32_t t = DisplayData[i];
+    DisplayData[i] = DisplayData[Channel - 1 - i];
+    DisplayData[Channel - 1 - i] = t;
+  }
 }
 
 /*
-*   Function to intialize the display array for FFT plot
-*   Input: int Channel - Number of channels to be displayed. i.e no of bars in the plot.
-*   Output: uint32_t *DisplayData - Reference to the array to store the data.
+*   Function to merge every two neighbouring channels of the display data into one.
+*   Used by the frame scheduler to draw half the bars when rendering can not keep up.
+*   Input: uint32_t* DisplayData - The display data, the merged channels are written to the first half.
+*   Input: int Channel - Number of channels.
+*   Output: int - Number of channels left.
 */
-uint32_t *InitializeDisplayArray(int Channel){
-    uint32_t *DisplayData = (uint32_t *)malloc(Channel * sizeof(uint32_t));     //Pretty self explanatory
-    for(int i = 0; i < Channel; i++){
-        DisplayData[i] = 0;
-    }
-    return DisplayData;
+int HalveDisplayData(uint32_t *DisplayData, int Channel){
+  for(int i = 0; i < Channel/2; i++){
+    DisplayData[i] = (DisplayData[2*i] + DisplayData[2*i + 1]) / 2;
+  }
+  return Channel/2;
 }
 
 void ClearDisplayBuffer(uint32_t *Array, int Size){
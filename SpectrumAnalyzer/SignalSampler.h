@@ -17,32 +17,65 @@
 #include <esp_adc_cal.h>
 #include <esp_err.h>
 #include <esp_log.h>
+#include <soc/syscon_struct.h>
 #include <Math.h>
 #include <stdio.h>
 #include <Arduino.h>
-#include "FFT.h"
+#include "SampleStages.h"                     //Brings FFT.h, which has no include guard
+#include "FilterEngine.h"
+#include "PartialTracker.h"
+#include "SignalGenerator.h"
 //#include <arduinoFFT.h>
 
 //DEFINES
 
-//Constants to define the sampling frequency and the number of samples to be taken.
-#define ReadFreq 11000
-#define BUFFER_SIZE 1024
-#define NumSeconds BUFFER_SIZE*(1.0/ReadFreq)
-#define ReadDelayUs 1000000.0*(1.0/ReadFreq)
+//ReadFreq, BUFFER_SIZE, CAPTURE_PERIOD_US, DUAL_CHANNEL and the channel tags of the i2s words are in SampleStages.h
 #define FFT_NOISE_THRESHOLD 4500
+#define FFTPLOT_BENCH_FREQ_START 50        //Lowest frequency of the bands measured by BenchmarkPrunedFFT()
 #define ADC_CHANNEL_USED ADC1_CHANNEL_6  //Formal name of Pin 34 (used for adc)
+#define AUX_ADC_CHANNEL_USED ADC1_CHANNEL_7  //Formal name of Pin 35, the AUX input (only used if DUAL_CHANNEL is 1)
+#define DUAL_DISPLAY_MODE 0              //0 -> the two spectra side by side, 1 -> L/R bars, low frequencies in the centre
+#define SYNTHETIC_SOURCE -1              //-1 samples the ADC, a SignalType (e.g. SIGNAL_CHIRP) feeds that source from boot instead. The 'g' command switches at runtime
+#define SYNTHETIC_FREQ 1000              //Frequency of the synthetic sine(Hz), the AUX input gets 1.5 times it. The chirp sweeps the FFT plot
+#define SYNTHETIC_AMPLITUDE 1500         //Peak amplitude of the synthetic sources(ADC counts)
+#define I2S_DMA_BUF_COUNT 4              //Number of DMA buffers the i2s driver cycles through
+#define I2S_BUFFERS_PER_FRAME ADC_CHANNEL_COUNT  //A DMA buffer holds BUFFER_SIZE words, so every channel needs one more buffer per frame
+#define I2S_EVENT_QUEUE_LEN 4            //Depth of the i2s event queue, one RX_DONE event per completed DMA buffer
+
+//FIR filter on the main input, see FilterEngine.h
+#define FILTER_OUTPUT 0                  //Setting this to 1 will filter the main input and play it on an I2S DAC(e.g. PCM5102) on I2S1
+#define FILTER_DISPLAY 0                 //Setting this to 1 will filter the main input before it is plotted, so the plots show the filtered signal
+#define FILTER_KIND FILTER_BANDPASS      //FILTER_BANDPASS, FILTER_NOTCH or FILTER_EQUALIZER
+#define FILTER_TAPS 255                  //Odd, at most FILTER_MAX_TAPS. A band narrower than about 3.3 * ReadFreq / FILTER_TAPS(140 Hz) is not resolved
+#define FILTER_FREQ_LOW 300              //Band of FILTER_BANDPASS and FILTER_NOTCH(Hz), 0 makes the band pass a low pass
+#define FILTER_FREQ_HIGH 3000
+#define FILTER_EQ_FREQS {60, 250, 1000, 4000}          //Centre of every band of FILTER_EQUALIZER(Hz)
+#define FILTER_EQ_GAINS_DB {6, 0, -6, 3}               //Gain of every band of FILTER_EQUALIZER(dB)
+#define FILTER_OUTPUT_GAIN 16            //12 bit ADC counts to 16 bit DAC counts
+#define FILTER_I2S_DMA_BUF_COUNT 4       //DMA buffers of the output, FILTER_BLOCK stereo samples each
+#define FILTER_I2S_BCK_PIN 26            //Pins of the I2S DAC
+#define FILTER_I2S_WS_PIN 25
+#define FILTER_I2S_DATA_PIN 27
 
 
 //Global variables
 const int AnalogPin = 34;                             //Input signal is connected to GPIO 34 (Analog ADC1_CH6) 
-const TickType_t xDelay = 3 / portTICK_PERIOD_MS;
+extern QueueHandle_t i2s_event_queue;                 //i2s driver posts an I2S_EVENT_RX_DONE here every time a DMA buffer completes
 //Function Definitions
-double GetSampledData(float* AnalogValue_re);
+unsigned long WaitForSampledData();
+double GetSampledData(float* AnalogValue_re, float* AuxValue_re = NULL, SignalGenerator *Source = NULL, SignalGenerator *AuxSource = NULL);
+void SelectSyntheticSource(int Type, SignalGenerator *Source, SignalGenerator *AuxSource);
+void DiscardSampledData();
 void ADCSetup(Stream &Serial);
-float ComputeFFT(fft_config_t *FFT, float *Magnitude);
-void PrepareDisplayData(float *AnalogValue_re, int FreqS, int FreqE, int Channel, int SamplFreq, int SamplSize, uint32_t *DisplayData);
+void FilterOutputSetup(Stream &Serial);
+FilterEngine *InitializeFilter(FilterEngine *Filter);
+void WriteFilteredData(const float *Samples, double Average);
+fft_config_t *InitializeFFT(float *Input, float *Output);
+fft_pruned_plan_t *InitializePrunedFFT(fft_config_t *FFT, int BinStart, int BinEnd, fft_pruned_plan_t *Plan);
+void ComputeDualFFT(fft_config_t *FFT, float *InputA, float *InputB, float *Packed, const unsigned short *BitReverse, int Pairs, float *OutputA, float *OutputB);
+void BenchmarkPrunedFFT(Stream &Serial, fft_config_t *FFT);
+void ReverseDisplayData(uint32_t *DisplayData, int Channel);
+int HalveDisplayData(uint32_t *DisplayData, int Channel);
 void PrintFFT(Stream &Serial, float *RealValue, int BUFFERSIZE);
-uint32_t *InitializeDisplayArray(int Channel);
 void ClearDisplayBuffer(uint32_t *Array, int Size);
 #endif
@@ -3,7 +3,21 @@
 #include <Math.h>
 #include "SignalSampler.h"
 #include "DisplayFunctions.h"
+#include "FramePipeline.h"
+#include "MemoryArena.h"
 #include "SPALSH_SCREEN.h"
+#include "SelfTest.h"
+#include "PipelineBenchmark.h"
+#include "FrameScheduler.h"
+#include "BeatDetector.h"
+#include "PitchMap.h"
+#include "MultiResolution.h"
+#include "PitchDetector.h"
+#include "MemoryTelemetry.h"
+#include "PowerGovernor.h"
+#include "TriggerEngine.h"
+#include "EventRecorder.h"
+#include "LatencyMonitor.h"
 //#include "FFT.h"
 
 //Use them to see the output of various functions on the serial monitor
@@ -13,45 +27,95 @@
 #define FFT_DATA_DEBUG        0               //Setting this to 1 will print FFT data
 #define WAVEFORM_DEBUG        0               //Setting this to 1 will print all data for Waveform Plot
 #define TIME_DEBUG            0               //Setting this to 1 will print time taken for each task.
+#define PIPELINE_DEBUG        0               //Setting this to 1 will print the per stage occupancy and drop counters.
+#define SCHEDULER_DEBUG       0               //Setting this to 1 will print the frame time histogram, jitter and missed deadlines.
+#define BEAT_DEBUG            0               //Setting this to 1 will print every beat and the tempo.
+#define PITCH_DEBUG           0               //Setting this to 1 will print the fundamental of every frame.
+#define PARTIAL_DEBUG         0               //Setting this to 1 will print the tracked partials of every frame.
+#define EVENT_DEBUG           0               //Setting this to 1 will print every event the recorder is frozen by.
+#define LATENCY_DEBUG         0               //Setting this to 1 will print the capture to display latency histogram.
+#define POWER_DEBUG           0               //Setting this to 1 will print the power level, the skipped frames and the time at every clock.
+#define MEMORY_DEBUG          0               //Setting this to 1 will print the footprint of every buffer after setup.
+#define TELEMETRY_DEBUG       0               //Setting this to 1 will print the stack high-water marks, heap and RAM counters every TELEMETRY_INTERVAL frames.
+#define FFT_BENCHMARK         0               //Setting this to 1 will time the pruned FFT against the full FFT during setup.
+#define PIPELINE_BENCHMARK    0               //Setting this to 1 will run the synthetic sources through the pipeline stages during setup and print the timings as JSON.
+#define SELF_TEST             0               //Setting this to 1 will check the FFT against a reference DFT during setup and halt if it fails.
+#define LATENCY_TEST          0               //Setting this to 1 will replace the main input with an impulse every LATENCY_TEST_PERIOD captures and time it until its beat is drawn.
 
 TFT_eSPI tft = TFT_eSPI();
 
 //----FOR FFT----
 //Variables
-float AnalogValue_re[BUFFER_SIZE];
-float FFT_output[BUFFER_SIZE];
-float Magnitude[BUFFER_SIZE/2 - 1];
-float MajorFreq = 0.0;
-double SignalAverage = 0.0;
+InputSpectrum MainSpectrum;                   //Magnitudes and bars of the main input, owned by the processing task
+InputSpectrum AuxSpectrum;                    //Same for the AUX input, only with DUAL_CHANNEL
 //Initialization of Arduino FFT object
 //arduinoFFT FFT = arduinoFFT(AnalogValue_re, AnalogValue_im, BUFFER_SIZE, ReadFreq);
-fft_config_t *FFT = fft_init(BUFFER_SIZE, FFT_REAL, FFT_FORWARD, AnalogValue_re, FFT_output);
-//Initialization of the Display Buffer
-uint32_t *FFTPLOT_DisplayData = InitializeDisplayArray(FFTPLOT_CHANNEL);
-bool editingDisplayData = false;
+//Created in setup(). The input and output buffers are pointed at the frame being computed, see DataProcessingTask_Code.
+fft_config_t *FFT;
+fft_pruned_plan_t *FFTPlan;                   //Only computes the bins shown on the FFT plot
+float *DualPacked;                            //Scratch space of ComputeDualFFT(), only with DUAL_CHANNEL
+unsigned short *DualBitReverse;               //Bit-reversal table of the in-place dual FFT, after DualPacked
+int DualPairs;
+PartialTracker Partials;                      //Strongest peaks with their frequency from the phase, owned by the processing task
+BeatDetector Beats;                           //Runs on the magnitudes of every frame, owned by the processing task
+PitchMap Pitch;                               //Folds the bins into notes for the chroma and piano plots
+MultiResolution MultiRes;                     //Long and short FFT of the multi-resolution plot, not with DUAL_CHANNEL
+FilterEngine Filter;                          //FIR filter on the main input, only with FILTER_OUTPUT or FILTER_DISPLAY
+float *FilteredSamples;                       //Where the filter writes when the plots show the unfiltered input
+PitchDetector Tracker;                        //Fundamental of every frame, shown by the tuner of the note plots
+TriggerEngine Trigger;                        //Where the waveform plot starts, owned by the processing task
+EventRecorder Recorder;                       //Compressed history of the main input, written by the acquisition task, not with DUAL_CHANNEL
+int16_t *EventSamples;                        //A capture decoded for the download
+PowerGovernor Governor;                       //Lowers the clock and skips frames in silence, owned by the processing task
 bool clearDisplay = false;
+volatile bool PeakReport = false;             //Set by the 'p' command, the processing task prints the peaks of its next frame
+volatile int8_t SignalSource = SYNTHETIC_SOURCE;   //-1 for the ADC or the SignalType fed instead, set by the 'g' command
 //--------
 
-bool StartDelay = false;    //used in Processing Task
+//Startup
+unsigned long SplashShownAt;                  //millis() when the splash was drawn
+bool FirstFrame = true;                       //Cleared once the first plot replaces the splash
+
+//Paces the visualization task at FPSdesired, or at the captures when they come slower
+FrameScheduler Scheduler;
+
+//Stack, heap and RAM counters, sampled by the visualization task
+MemoryTelemetry Telemetry;
+
+//Time from the capture to the plot on the display, kept by the visualization task
+LatencyMonitor Latency;
+LatencyMonitor ImpulseLatency;                //Only with LATENCY_TEST
 
 //RGB color Stuff
 RGBColor FFTPLOT_Color = RGBColor(5);
 
 //Button Structure for Plot Change Button
 Button PlotChangeButton = {PUSH_BUTTON_PIN, 0, false};
+volatile uint8_t PlotMode = PLOT_WAVEFORM;    //One of PlotModes, every press moves to the next one
+
+static_assert(PITCH_MAX_KEYS <= FFTPLOT_CHANNEL, "The piano plot needs a DisplayData slot per key");
+static_assert(MULTIRES_LONG_SIZE == BUFFER_SIZE, "The long FFT of the multi-resolution plot shares the twiddle factors of the main FFT");
+static_assert(MULTIRES_MAX_BARS >= FFTPLOT_CHANNEL, "The multi-resolution plot needs a bar per channel");
+static_assert(FILTER_TAPS <= FILTER_MAX_TAPS && BUFFER_SIZE % FILTER_BLOCK == 0, "The filter has to fit the overlap-save blocks");
 
 //Interrupt function for Plot Mode change button
 void IRAM_ATTR PlotModeChange(){
   PlotChangeButton.NumPresses++;
   PlotChangeButton.state = (PlotChangeButton.state)? false: true;   
+  do{
+    PlotMode = (PlotMode + 1) % PLOT_MODE_COUNT;
+  }while(DUAL_CHANNEL && PlotMode == PLOT_MULTIRES);  //Only one input fits that plot
   clearDisplay = true;  
 }
 
 //Main tasks decleration
+//Acquisition -> Processing -> Visualization, frames are handed over through the queues in FramePipeline.h
+TaskHandle_t DataAcquisitionTask;
 TaskHandle_t DataProcessingTask;
 TaskHandle_t DataVisualizationTask;
 
 //Task Function Prototypes
+void DataAcquisitionTask_Code(void *Parameter);
 void DataProcessingTask_Code(void *Parameter);
 void DataVisualizationTask_Code(void *Parameter);
 
@@ -60,94 +124,419 @@ void setup() {
     Serial.begin(115200);
   // Setup the TFT screen
     TFTsetup(tft);
+  // Display the SPLASH Animation, everything below runs while it is shown.
+  // The visualization task removes it once SPLASH_MIN_TIME has passed.
+    DrawRLEImage(tft, 0, 4, SPALSH_SCREEN.width, SPALSH_SCREEN.height, SPALSH_SCREEN.data, SPALSH_SCREEN.length);
+    SplashShownAt = millis();
   // Setup the ADC
     ADCSetup(Serial);
-  // Setup the viewing scale
+    if(FILTER_OUTPUT){
+      FilterOutputSetup(Serial);
+    }
+  // Setup the viewing scale, the trigger has to leave room for the samples it spans and keeps the end of every capture
     SetViewScale(Serial);
-  // Display the SPLASH Animation
-    tft.pushImage(0,4,SPALSH_SCREEN.width,SPALSH_SCREEN.height,SPALSH_SCREEN.data);
-    delay(5000);
-    tft.fillScreen(BG_Color);
-    delay(250);    
+    InitializeTriggerEngine(&Trigger, TRIGGER_EDGE, TRIGGER_MODE, TRIGGER_LEVEL, TRIGGER_HYSTERESIS, (unsigned long)(TRIGGER_HOLDOFF_US * (ReadFreq / 1000000.0)), WaveformWindow(),
+                            (float *)ArenaAlloc(ARENA_BUDGET_TRIGGER, "Trigger history", ARENA_SAMPLES));
   // Setup Hardware interrupt for the PUSH Button
     pinMode(PlotChangeButton.PIN, INPUT);
     attachInterrupt(PlotChangeButton.PIN, PlotModeChange, RISING); 
-  // Setup the tasks to run on different cores.
-    xTaskCreatePinnedToCore(DataProcessingTask_Code, "ProcessingTask", 10000, NULL, 1, &DataProcessingTask, 0); 
-    delay(500);
-    xTaskCreatePinnedToCore(DataVisualizationTask_Code, "VisualizationTask", 10000, NULL, 1, &DataVisualizationTask, 1);
-    delay(1000); 
-    Serial.println("Setup Complete");
-  //used for FrameRate calculations
-    ttime_start = micros();
+  // Check the FFT kernels before anything depends on them
+    if(SELF_TEST){
+      if(RunFFTSelfTest() != 0){
+        Serial.println("FFT self test failed");
+        while(1);
+      }
+    }
+  // Carve the frames and the FFT out of the arena and hand all frames to the acquisition stage
+    InitializeFramePool();
+    if(FILTER_OUTPUT || FILTER_DISPLAY){
+      InitializeFilter(&Filter);
+      FilteredSamples = FILTER_DISPLAY? NULL : (float *)ArenaAlloc(ARENA_BUDGET_FILTERED, "Filtered samples", ARENA_SAMPLES);
+    }
+    FFT = InitializeFFT(FramePool[0].Samples, FramePool[0].Spectrum);
+    if(FFT_BENCHMARK){
+      BenchmarkPrunedFFT(Serial, FFT);
+    }
+    //The band of the plot is fixed at build time, InputSpectrum has its bins.
+    FFTPlan = InitializePrunedFFT(FFT, InputSpectrum::BinStart, InputSpectrum::PlanEnd, NULL);
+    InitializePartialTracker(&Partials, FFT->twiddle_factors, (float *)ArenaAlloc(ARENA_BUDGET_PARTIALS, "Partial tracker", ARENA_SAMPLES), BUFFER_SIZE, ReadFreq, InputSpectrum::BinStart, InputSpectrum::LastBin);
+    InitializeBeatDetector(&Beats, (float *)ArenaAlloc(ARENA_BUDGET_BEAT, "Beat history", ARENA_SPECTRA), InputSpectrum::BinStart, InputSpectrum::LastBin);
+    if(!DUAL_CHANNEL){
+      InitializeMultiResolution(&MultiRes, (float *)ArenaAlloc(ARENA_BUDGET_MULTIRES, "Multi-resolution", ARENA_SPECTRA), FFT->twiddle_factors, FFTPLOT_CHANNEL, FFTPLOT_FREQ_START, FFTPLOT_FREQ_END, ReadFreq);
+    }
+    InitializePitchMap(&Pitch, (PitchMapEntry *)ArenaAlloc(ARENA_BUDGET_PITCH_MAP, "Pitch map", ARENA_DISPLAY), InputSpectrum::BinStart, InputSpectrum::LastBin, ReadFreq, BUFFER_SIZE);
+    if(DUAL_CHANNEL){
+      DualPacked = (float *)ArenaAlloc(ARENA_BUDGET_DUAL_FFT, "Dual FFT packing", ARENA_SPECTRA);
+      DualBitReverse = (unsigned short *)(DualPacked + 2*BUFFER_SIZE);
+      DualPairs = fft_bitrev_init(DualBitReverse, BUFFER_SIZE);
+    }
+    //The packing of the dual FFT is free again by the time the pitch detector runs.
+    if(!DUAL_CHANNEL){
+      uint8_t *History = (uint8_t *)ArenaAlloc(ARENA_BUDGET_EVENTS, "Event history", ARENA_SAMPLES);
+      EventSamples = (int16_t *)(History + EVENT_HISTORY_BYTES);
+      InitializeEventRecorder(&Recorder, History, EVENT_HISTORY_BYTES);
+    }
+    InitializePitchDetector(&Tracker, FFT->twiddle_factors, DUAL_CHANNEL? DualPacked : (float *)ArenaAlloc(ARENA_BUDGET_PITCH, "Autocorrelation", ARENA_SPECTRA), BUFFER_SIZE, ReadFreq);
+    if(PIPELINE_BENCHMARK){
+      RunPipelineBenchmark(Serial, tft, FFT, FFTPlan, FramePool);
+    }
+  //Frame pacing of the visualization task, frame also drives the rainbow
+    InitializeFrameScheduler(&Scheduler, FPSdesired, CAPTURE_PERIOD_US, micros());
+    InitializeLatencyMonitor(&Latency);
+    InitializeLatencyMonitor(&ImpulseLatency);
+    InitializePowerGovernor(&Governor, micros());
     frame = 0;
     FFTPLOT_Color.SetFrame(frame);
+  // Setup the tasks to run on different cores, their stacks come from the arena as well.
+  // The later stages are created first as they only sleep until the stage before notifies them.
+  // Acquisition has the highest priority so a completed DMA buffer is picked up straight away.
+    DataVisualizationTask = CreateStaticTask(DataVisualizationTask_Code, "VisualizationTask", TASK_STACK_VISUALIZATION, 1, 1);
+    DataProcessingTask = CreateStaticTask(DataProcessingTask_Code, "ProcessingTask", TASK_STACK_PROCESSING, 1, 0);
+    DataAcquisitionTask = CreateStaticTask(DataAcquisitionTask_Code, "AcquisitionTask", TASK_STACK_ACQUISITION, 2, 0);
+  // Watch the stacks of the tasks, the first sample is taken after TELEMETRY_INTERVAL frames.
+    InitializeMemoryTelemetry(&Telemetry);
+    WatchTask(&Telemetry, "AcquisitionTask", DataAcquisitionTask, TASK_STACK_ACQUISITION);
+    WatchTask(&Telemetry, "ProcessingTask", DataProcessingTask, TASK_STACK_PROCESSING);
+    WatchTask(&Telemetry, "VisualizationTask", DataVisualizationTask, TASK_STACK_VISUALIZATION);
+    WatchTask(&Telemetry, "loopTask", xTaskGetCurrentTaskHandle(), TASK_STACK_LOOP);
+    if(MEMORY_DEBUG){
+      PrintMemoryReport(Serial);
+    }
+    Serial.printf("Setup Complete in %lu ms\n", millis());
 }
 
 void loop() {
-  //Empty Loop
+  //Serial commands:
+  //  p - print the peaks of the next frame, with their frequency, magnitude and prominence
+  //  g - next input: the ADC, then every synthetic source of SignalGenerator in turn
+  //and of the event recorder, not with DUAL_CHANNEL:
+  //  t - take an event now, s - print the state, d - download the frozen history, r - release it and record again
+  if(Serial.available()){
+    char Command = Serial.read();
+    if(Command == 'p'){
+      PeakReport = true;
+    }
+    else if(Command == 'g'){
+      SignalSource = (SignalSource + 2) % (SIGNAL_TYPE_COUNT + 1) - 1;
+      Serial.printf("Input: %s\n", (SignalSource < 0)? "adc" : SignalTypeName((SignalType)SignalSource));
+    }
+    else if(!DUAL_CHANNEL && Command == 't'){
+      TriggerEvent(&Recorder, Recorder.Recorded + 1);
+    }
+    else if(!DUAL_CHANNEL && Command == 's'){
+      PrintEventRecorder(Serial, &Recorder, EventSamples, false);
+    }
+    else if(!DUAL_CHANNEL && Command == 'd'){
+      if(Recorder.Frozen){
+        PrintEventRecorder(Serial, &Recorder, EventSamples, true);
+      }
+      else{
+        Serial.println("No event recorded yet");
+      }
+    }
+    else if(!DUAL_CHANNEL && Command == 'r'){
+      ReleaseEvent(&Recorder);
+    }
+  }
+  delay(50);
 }
 
 //Tasks Definitions
+void DataAcquisitionTask_Code(void *Parameter){
+  unsigned long Sequence = 0;
+  //The latency test feeds silence with an impulse at the start of every LATENCY_TEST_PERIOD-th capture.
+  SignalGenerator Impulses;
+  InitializeSignalGenerator(&Impulses, SIGNAL_IMPULSE, ReadFreq, 0, 0, LATENCY_TEST_AMPLITUDE);
+  Impulses.Period = LATENCY_TEST_PERIOD * BUFFER_SIZE;
+  //Synthetic inputs, set up again whenever the 'g' command picks another one.
+  SignalGenerator Source, AuxSource;
+  int8_t ActiveSource = -1;
+  while(1){
+    //This task only moves samples from the DMA into frames, so the DMA never waits on the FFT.
+
+    //1. Sleep until the DMA completes a buffer.
+    unsigned long CaptureUs = WaitForSampledData();
+    unsigned long timee = micros();
+    uint8_t Depth = FreeQueue.Count();
+    Sequence++;
+
+    //2. Take an empty frame. If the later stages hold all of them, drop this capture.
+    Frame *frm;
+    if(!FreeQueue.Pop(frm)){
+      DiscardSampledData();
+      AcquireStats.Drops++;
+      continue;
+    }
+    frm->CaptureUs = CaptureUs;
+    frm->ImpulseUs = (LATENCY_TEST && Impulses.Sample % Impulses.Period == 0)? CaptureUs - CAPTURE_PERIOD_US : 0;   //Sample 0 is a capture older than the newest
+    int8_t Wanted = SignalSource;
+    if(Wanted != ActiveSource && Wanted >= 0){
+      SelectSyntheticSource(Wanted, &Source, &AuxSource);
+    }
+    ActiveSource = Wanted;
+    if(LATENCY_TEST){
+      frm->SignalAverage = GetSampledData(frm->Samples, frm->SamplesAux, &Impulses);
+    }
+    else if(ActiveSource >= 0){
+      frm->SignalAverage = GetSampledData(frm->Samples, frm->SamplesAux, &Source, &AuxSource);
+    }
+    else{
+      frm->SignalAverage = GetSampledData(frm->Samples, frm->SamplesAux);
+    }
+    frm->Sequence = Sequence;
+    if(!DUAL_CHANNEL){
+      RecordCapture(&Recorder, frm->Samples, BUFFER_SIZE, Sequence);   //Before the filter, the history is the raw input
+    }
+
+    //3. Hand it to the processing task.
+    ComputeQueue.Push(frm);
+    xTaskNotifyGive(DataProcessingTask);
+    UpdateStageStats(AcquireStats, Depth, micros() - timee);
+  }
+}
+
 void DataProcessingTask_Code(void *Parameter){
+  uint8_t LastMode = PlotMode;                //A new plot mode wakes the power governor up and re-arms the trigger
+  uint8_t AppliedLevel = POWER_FULL;          //Power level the ESP32 is in
+  unsigned long LastBusy = 0;                 //Time spent on the last frame, the load seen by the power governor
+  bool EventReported = false;                 //The frozen event has been printed
   while(1){
-    unsigned long timee = micros();       //Legacy code, used to get the time spent in the function
-    //This task deals with all the stuff that is associated with Data acqisition and processing
-
-    //This delay is added to give system time to setup and get the samples.
-    if(StartDelay){
-      delayMicroseconds(25000);
-      StartDelay = true;
-    }
-    //1. Get the sampled data
-    SignalAverage = GetSampledData(AnalogValue_re);
-    //Serial.print("Got Signal\n");
-    if(PlotChangeButton.state){ //No need if we are only using waveform plot i.e state = 0
-      //2. Compute FFT and get frequency data
-      MajorFreq = ComputeFFT(FFT, Magnitude);
-      //Serial.println("GOT FFT Data");
-      //Print the FFT (if required)
-      if(FFT_DATA_DEBUG){
-        PrintFFT(Serial, FFT_output, BUFFER_SIZE);
+    //This task deals with all the stuff that is associated with processing
+
+    //1. Sleep until the acquisition task hands over a frame.
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    Frame *frm;
+    while(ComputeQueue.Pop(frm)){
+      unsigned long timee = micros();       //Used to get the time spent on the frame
+      uint8_t Depth = ComputeQueue.Count() + 1;
+
+      //Filter the main input, in place if the plots are to show the filtered signal.
+      if(FILTER_OUTPUT || FILTER_DISPLAY){
+        float *Filtered = FILTER_DISPLAY? frm->Samples : FilteredSamples;
+        RunFilterEngine(&Filter, frm->Samples, Filtered, BUFFER_SIZE, frm->SignalAverage);
+        if(FILTER_OUTPUT){
+          WriteFilteredData(Filtered, frm->SignalAverage);
+        }
       }
+
+      frm->Mode = PlotMode;
+      frm->HasSpectrum = (frm->Mode != PLOT_WAVEFORM);
+      frm->Redundant = false;
+      frm->TriggerIndex = 0;
+      bool ModeChanged = (frm->Mode != LastMode);
+      LastMode = frm->Mode;
+
+      //A loud capture is an event for the recorder, it keeps EVENT_POST_BLOCKS more captures and freezes.
+      if(!DUAL_CHANNEL && PeakDeviation(frm->Samples, BUFFER_SIZE, frm->SignalAverage) > EVENT_LEVEL){
+        TriggerEvent(&Recorder, frm->Sequence);
+      }
+      if(!DUAL_CHANNEL && EVENT_DEBUG){
+        bool Frozen = Recorder.Frozen;
+        if(Frozen && !EventReported){
+          PrintEventRecorder(Serial, &Recorder, EventSamples, false);
+        }
+        EventReported = Frozen;
+      }
+
+      //Power level from the signal and the load, activity gets full power before this frame is computed.
+      bool SkipCompute = false;
+      if(POWER_GOVERNOR){
+        float Rms = SignalRms(frm->Samples, BUFFER_SIZE, frm->SignalAverage);
+        uint8_t Level = UpdatePowerGovernor(&Governor, micros(), Rms, ModeChanged, LastBusy, CAPTURE_PERIOD_US);
+        if(Level != AppliedLevel){
+          ApplyPowerLevel(Level);
+          AppliedLevel = Level;
+        }
+        SkipCompute = PowerSkipCompute(&Governor, Rms);
+        frm->Redundant = SkipCompute;
+        if(POWER_DEBUG && (Governor.Frames % PIPELINE_STATS_INTERVAL == 0)){
+          PrintPowerGovernorStats(Serial, &Governor);
+        }
+      }
+      frm->Channels = FFTPLOT_CHANNEL;
+      frm->Beat = false;
+      frm->Pitch = 0;
+      frm->PartialCount = 0;
+      frm->MarkerCount = 0;
+      if(frm->HasSpectrum && !SkipCompute){ //No need if we are only using waveform plot, or for silence at the lowest power level
+        //2. Compute FFT and get frequency data
+        if(DUAL_CHANNEL){
+          //Both inputs with one complex FFT, each gets half of the bars.
+          ComputeDualFFT(FFT, frm->Samples, frm->SamplesAux, DualPacked, DualBitReverse, DualPairs, frm->Spectrum, frm->SpectrumAux);
+          TrackPartials(&Partials, frm->Samples, frm->Spectrum, frm->Sequence);
+          frm->MajorFreqAux = AuxSpectrum.Magnitudes(frm->SpectrumAux);
+        }
+        else{
+          FFT->input = frm->Samples;
+          FFT->output = frm->Spectrum;
+          ComputeFFT(FFT, FFTPlan, &Partials, frm->Sequence);
+        }
+        frm->MajorFreq = MainSpectrum.Magnitudes(frm->Spectrum);
+        //The partials know the frequency to a fraction of a bin, the strongest one is the major frequency.
+        frm->PartialCount = Partials.Count;
+        memcpy(frm->Partials, Partials.Partials, Partials.Count * sizeof(Partial));
+        if(Partials.Count > 0){
+          frm->MajorFreq = Partials.Partials[0].Frequency;
+        }
+        if(PARTIAL_DEBUG || PeakReport){
+          PrintPartials(Serial, frm->Partials, frm->PartialCount, frm->Sequence);
+          PeakReport = false;
+        }
+        //Onsets from the change against the last frame. The time comes from the capture number, so dropped frames do not skew the tempo.
+        frm->Beat = DetectBeat(&Beats, frm->Spectrum, frm->Sequence * CAPTURE_PERIOD_US);
+        frm->Bpm = Beats.Bpm;
+        if(!DUAL_CHANNEL && EVENT_ON_ONSET && frm->Beat){
+          TriggerEvent(&Recorder, frm->Sequence);
+        }
+        if(BEAT_DEBUG && frm->Beat){
+          Serial.printf("Beat %lu, %.1f BPM, strength %.2f\n", Beats.Beats, Beats.Bpm, Beats.Strength);
+        }
+        //Serial.println("GOT FFT Data");
+        //Print the FFT (if required)
+        if(FFT_DATA_DEBUG){
+          PrintFFT(Serial, frm->Spectrum, BUFFER_SIZE);
+        }
+
+        //3. Prepare the FFT data for Displaying.
+        if(frm->Mode == PLOT_CHROMA || frm->Mode == PLOT_PIANO){
+          //Notes of the main input only, the map was made at setup so this is one multiply and add per entry.
+          frm->Channels = ApplyPitchMap(&Pitch, frm->Spectrum, frm->Mode == PLOT_CHROMA, frm->DisplayData);
+        }
+        else if(frm->Mode == PLOT_MULTIRES){
+          //Bass from the decimated last frames, treble from the end of this one.
+          frm->Channels = ComputeMultiResolution(&MultiRes, frm->Samples, BUFFER_SIZE, frm->DisplayData);
+        }
+        else if(DUAL_CHANNEL){
+          MainSpectrum.PrepareBars(frm->Spectrum, frm->DisplayData);
+          AuxSpectrum.PrepareBars(frm->SpectrumAux, frm->DisplayData + InputSpectrum::Channels);
+          if(DUAL_DISPLAY_MODE == 1){
+            ReverseDisplayData(frm->DisplayData, InputSpectrum::Channels);   //Left input grows from the centre to the left
+          }
+        }
+        else{
+          MainSpectrum.PrepareBars(frm->Spectrum, frm->DisplayData);
+        }
+        //Markers over the bars of the partials, the main input is the first half of the bars with DUAL_CHANNEL.
+        if(PEAK_MARKERS && frm->Mode == PLOT_FFT){
+          for(int i = 0; i < frm->PartialCount; i++){
+            int Bar = InputSpectrum::BarOf(frm->Partials[i].Frequency);
+            if(Bar >= 0){
+              frm->Markers[frm->MarkerCount++] = (DUAL_CHANNEL && DUAL_DISPLAY_MODE == 1)? InputSpectrum::Channels - 1 - Bar : Bar;
+            }
+          }
+        }
+        //Serial.println("GOT Display Data");
       
-      //This delay will ensure that watch dog timers are reset.
-      vTaskDelay(xDelay); 
-
-      //3. Prepare the FFT data for Displaying.
-//      while(editingDisplayData){ //Wait if the Display Buffer is beings used by processing task
-//        Serial.println("DP Waiting for DispBuffer");
-//      } 
-      editingDisplayData = true;
-      PrepareDisplayData(FFT_output, FFTPLOT_FREQ_START, FFTPLOT_FREQ_END, FFTPLOT_CHANNEL, ReadFreq, BUFFER_SIZE, FFTPLOT_DisplayData);
-      editingDisplayData = false;
-      //Serial.println("GOT Display Data");
-      
-      //4. Get Major Frequency from our data
-//      MajorFreq = FFT.MajorPeak(AnalogValue_re, BUFFER_SIZE, ReadFreq);
-      //Serial.printf("Major Frequency: %.6lf\n", MajorFreq);      
-      //Print the Display Data obtained (if required)
-      if(DISPLAY_DATA_DEBUG){
-        for(int i = 0; i < FFTPLOT_CHANNEL; i++){
-          Serial.println(FFTPLOT_DisplayData[i]);
+        //4. Get Major Frequency from our data
+//        MajorFreq = FFT.MajorPeak(AnalogValue_re, BUFFER_SIZE, ReadFreq);
+        //Serial.printf("Major Frequency: %.6lf\n", MajorFreq);      
+        //Print the Display Data obtained (if required)
+        if(DISPLAY_DATA_DEBUG){
+          for(int i = 0; i < frm->Channels; i++){
+            Serial.println(frm->DisplayData[i]);
+          }
+        }
+        //5. Fundamental from the autocorrelation of the samples. It uses the spectrum as work space, so this comes last.
+        frm->Pitch = DetectPitch(&Tracker, frm->Samples, frm->SignalAverage, frm->Spectrum);
+        if(PITCH_DEBUG){
+          Serial.printf("Pitch: %.2f Hz, confidence %.2f\n", Tracker.Pitch, Tracker.Confidence);
         }
       }
-    }
-    if(TIME_DEBUG){
-      Serial.print("Time Taken by Processing Task:");
-      Serial.println(timee);
+      else if(!frm->HasSpectrum && !SkipCompute){
+        //Waveform: the plot starts at the trigger, a capture the trigger does not want drawn is skipped.
+        if(ModeChanged){
+          ArmTrigger(&Trigger);
+        }
+        frm->TriggerIndex = FindTrigger(&Trigger, frm->Samples, BUFFER_SIZE, frm->SignalAverage, frm->Sequence);
+        frm->Redundant = (frm->TriggerIndex < 0);
+      }
+      //6. Below full power a frame that would draw the same plot again is not drawn.
+      if(POWER_GOVERNOR && !SkipCompute && !frm->Redundant){
+        if(frm->HasSpectrum){
+          frm->Redundant = PowerSkipRender(&Governor, frm->DisplayData, NULL, frm->Channels, 1);
+        }
+        else{
+          frm->Redundant = PowerSkipRender(&Governor, NULL, frm->Samples + ((frm->TriggerIndex > 0)? frm->TriggerIndex : 0), WaveformWindow() / Wskip, Wskip);
+        }
+      }
+      //7. Hand the frame to the visualization task.
+      RenderQueue.Push(frm);
+      xTaskNotifyGive(DataVisualizationTask);
+      timee = micros() - timee;
+      LastBusy = timee;
+      UpdateStageStats(ComputeStats, Depth, timee);
+      if(TIME_DEBUG){
+        Serial.print("Time Taken by Processing Task:");
+        Serial.println(timee);
+      }
     }
   }
 }
 
 
 void DataVisualizationTask_Code(void *Parameter){
+uint8_t LastQuality = FRAME_QUALITY_FULL;
+bool Beat = false;                          //A beat arrived since the last color change
+unsigned long ImpulseUs = 0;                //Latency test: the impulse waiting for a frame to be drawn, 0 for none
+bool ImpulseBeat = false;                   //Its frame had the beat
 while(1){
-   unsigned long timee = micros();       //Legacy code, used to get the time spent in the function
   //This task deals will all the stuff associated with displaying and visualization of the FFT Data.
-  
-  //Get FrameRate  
-  double frate = GetFrameRate(micros());
+
+  //Sleep until the next deadline of the frame scheduler.
+  long Wait = FrameTimeToDeadline(&Scheduler, micros());
+  if(Wait > 0){
+    vTaskDelay(pdMS_TO_TICKS((Wait + 999) / 1000));
+  }
+  //Only the newest frame is drawn, older ones that piled up are handed straight back.
+  ulTaskNotifyTake(pdTRUE, 0);              //The queue is read below, the notifications of its frames are not needed
+  Frame *frm = NULL;
+  Frame *newer;
+  uint8_t Depth = RenderQueue.Count();
+  while(RenderQueue.Pop(newer)){
+    if(frm != NULL){
+      FreeQueue.Push(frm);
+      RenderStats.Drops++;
+    }
+    frm = newer;
+    Beat |= frm->HasSpectrum && frm->Beat;  //A beat in a dropped frame still counts
+    //So does an impulse, it is timed to the next frame that is drawn.
+    if(LATENCY_TEST && frm->ImpulseUs != 0){
+      if(ImpulseUs != 0){
+        ImpulseLatency.Missed++;            //The one before never made it to the display
+      }
+      ImpulseUs = frm->ImpulseUs;
+      ImpulseBeat = frm->HasSpectrum && frm->Beat;
+    }
+  }
+  if(frm == NULL){
+    //Nothing new from the processing task, sleep until it publishes a frame.
+    FrameStarved(&Scheduler);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    continue;
+  }
+  //Keep the splash up for its minimum time, the frames are not drawn until then.
+  if(FirstFrame){
+    if(millis() - SplashShownAt < SPLASH_MIN_TIME){
+      FreeQueue.Push(frm);
+      continue;
+    }
+    tft.fillScreen(BG_Color);
+  }
+  //Nothing new to draw, the last plot stays on the screen.
+  if(frm->Redundant && !clearDisplay && !FirstFrame){
+    FreeQueue.Push(frm);
+    continue;
+  }
+  unsigned long timee = micros();
+  FrameStarted(&Scheduler, timee);
+  frame++;
+
+  //Under load the scheduler asks for less detail, clear what the last frame drew when that changes.
+  bool DrawText = Scheduler.Quality < FRAME_QUALITY_NO_TEXT;
+  if(Scheduler.Quality != LastQuality){
+    LastQuality = Scheduler.Quality;
+    clearDisplay = true;
+  }
 
   //If button was pressed recently, then clear the last plot type.
   if(clearDisplay){
@@ -157,44 +546,90 @@ while(1){
   
   //  Print Button State: 
   if(BUTTON_DEBUG){
-    Serial.printf("\nButton state: %i, presses: %d\n", PlotChangeButton.state, PlotChangeButton.NumPresses); 
+    Serial.printf("\nButton state: %i, plot mode: %d, presses: %d\n", PlotChangeButton.state, PlotMode, PlotChangeButton.NumPresses); 
   }
   //Do Color Stuff
   uint16_t PlotColor = Rainbow?FFTPLOT_Color.RGBValue(): FFTPLOT_DEFAULT_COLOR;
   
-  if(PlotChangeButton.state){  //Based on button state, plot the waveform or FFT Plot
+  if(frm->Mode == PLOT_CHROMA || frm->Mode == PLOT_PIANO){
+    //Plot the notes, there are few enough bars that they are never halved
+    PlotNoteBarGraph(tft, frm->DisplayData, frm->Channels, frm->Pitch, Pitch.LowestMidi, frm->Mode == PLOT_CHROMA, Scheduler.FrameRate, PlotColor, DrawText);
+  }
+  else if(frm->HasSpectrum){  //Based on how the frame was processed, plot the waveform or FFT Plot
     //Plot the FFT Plot
-     while(editingDisplayData){ //Wait if the Display Buffer is beight used by processing task
-       Serial.println("DV Waiting for DispBuffer");
-     } 
-     editingDisplayData = true;
-     PlotFFTBarGraph(tft, FFTPLOT_DisplayData, FFTPLOT_CHANNEL, MajorFreq, frate, PlotColor);
-     editingDisplayData = false;  
+    int Channel = frm->Channels;
+    if(Scheduler.Quality >= FRAME_QUALITY_HALF_CHANNELS){
+      Channel = HalveDisplayData(frm->DisplayData, Channel);
+      for(int i = 0; i < frm->MarkerCount; i++){
+        frm->Markers[i] /= 2;                 //Two bars became one
+      }
+    }
+    PlotFFTBarGraph(tft, frm->DisplayData, Channel, frm->MajorFreq, Scheduler.FrameRate, PlotColor, DrawText, frm->Markers, frm->MarkerCount);
   }
   else{
     //Plot the sampled data on the TFT screen (if want to see the waveform)
-    PlotSampledData(tft, AnalogValue_re, SignalAverage, frate, PlotColor);
+    PlotSampledData(tft, frm->Samples + ((frm->TriggerIndex > 0)? frm->TriggerIndex : 0), frm->SignalAverage, Scheduler.FrameRate, PlotColor, DrawText);
   
     //Print the sampled data to the serial port
     if(WAVEFORM_DEBUG){
-      PrintSampledData(Serial, AnalogValue_re);
+      PrintSampledData(Serial, frm->Samples);
     }
   }
+  if(FirstFrame){
+    FirstFrame = false;
+    Serial.printf("Time to first frame: %lu ms\n", millis());
+  }
+  //The plot is on the display, time it from the capture. An impulse of the latency test counts once it is drawn as a beat,
+  //from a frame that was dropped or skipped it is drawn with this one.
+  unsigned long Drawn = micros();
+  RecordLatency(&Latency, Drawn - frm->CaptureUs);
+  if(LATENCY_TEST && ImpulseUs != 0){
+    if(ImpulseBeat){
+      RecordLatency(&ImpulseLatency, Drawn - ImpulseUs);
+    }
+    else{
+      ImpulseLatency.Missed++;
+    }
+    ImpulseUs = 0;
+    ImpulseBeat = false;
+  }
+  //Give the frame back to the acquisition task.
+  FreeQueue.Push(frm);
+  UpdateStageStats(RenderStats, Depth, micros() - timee);
+  FrameFinished(&Scheduler, micros());
+  if(PIPELINE_DEBUG && (RenderStats.Frames % PIPELINE_STATS_INTERVAL == 0)){
+    PrintPipelineStats(Serial);
+  }
+  if(LATENCY_DEBUG && (RenderStats.Frames % PIPELINE_STATS_INTERVAL == 0)){
+    PrintLatencyStats(Serial, &Latency, "Capture to Display", CAPTURE_PERIOD_US);
+  }
+  if(LATENCY_TEST && (RenderStats.Frames % PIPELINE_STATS_INTERVAL == 0)){
+    PrintLatencyStats(Serial, &ImpulseLatency, "Impulse to Beat", 0);
+  }
+  if(RenderStats.Frames % TELEMETRY_INTERVAL == 0){
+    SampleMemoryTelemetry(&Telemetry, ArenaBase(), ArenaUsed(), ARENA_SIZE);
+    if(TELEMETRY_DEBUG){
+      PrintMemoryTelemetry(Serial, &Telemetry);
+    }
+  }
+  if(SCHEDULER_DEBUG && (Scheduler.Frames % PIPELINE_STATS_INTERVAL == 0)){
+    PrintFrameSchedulerStats(Serial, &Scheduler);
+  }
 
-  //Get next color every X frame only for rainbow
+  //Get next color on a beat, or every X frame, only for rainbow
   if(Rainbow){
-      if((frame - FFTPLOT_Color.GetFrame()) > ColorChangeThreshold){
+    if(RainbowOnBeat && PlotMode != PLOT_WAVEFORM){
+      if(Beat){
+        for(int i = 0; i < BeatColorSteps; i++){
+          FFTPLOT_Color.UpdateRainbow();
+        }
+        Beat = false;
+      }
+    }
+    else if((frame - FFTPLOT_Color.GetFrame()) > ColorChangeThreshold){
       FFTPLOT_Color.UpdateRainbow();
       FFTPLOT_Color.SetFrame(frame);
     }
   }
-    
-  //Now add the delay to keep the fps stable
-    timee = micros() - timee;                 //Calculate the time taken to plot the data.
-    int16_t Delay = ceil(1/(FPSdesired*1.0)*1000 - timee/1000.0);    //adaptive delay
-    if(Delay < 0){
-      Delay = FPSDelay; //Worst case scenario.
-    }
-  delay(Delay);
 }
 }
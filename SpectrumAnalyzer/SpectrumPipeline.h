@@ -0,0 +1,120 @@
+/*
+    * SpectrumPipeline.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the spectrum stage of one input as a class
+    *  template. The FFT size, sample rate, number of bars and the band are
+    *  template arguments, so the bin map and the loop bounds are compile time
+    *  constants and the magnitude and bar loops are specialized for them.
+    *  Every input gets its own instance, the state of one never leaks into another.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _SPECTRUMPIPELINE_H
+#define _SPECTRUMPIPELINE_H
+
+#include <stdint.h>
+#include <math.h>
+
+//N - FFT size, Fs - sample rate(Hz), Bars - bars of the plot, FreqStart/FreqEnd - band of the plot(Hz).
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd>
+class SpectrumPipeline{
+  public:
+    //Bin map, rounded the way the plot has always done it: whole Hz per bin, first bin at or above the frequency.
+    static constexpr int BinSize = Fs / N;
+    static constexpr int BinStart = (FreqStart + BinSize - 1) / BinSize;
+    static constexpr int BinEnd = (FreqEnd + BinSize - 1) / BinSize;
+    static constexpr int PlanEnd = (BinEnd < N/2)? BinEnd : N/2;               //Last bin of the pruned FFT plan
+    static constexpr int LastBin = (BinEnd < N/2 - 1)? BinEnd : N/2 - 1;       //Last bin with a magnitude
+    static constexpr int BinsPerBar = (BinEnd - BinStart + 1) / Bars;           //The bins left over are not plotted
+    static constexpr int Channels = Bars;
+
+    static_assert((N & (N - 1)) == 0 && N >= 4, "The FFT size has to be a power of two");
+    static_assert(BinSize > 0, "The sample rate has to be at least the FFT size");
+    static_assert(BinStart >= 1 && BinStart <= LastBin, "The band has to hold at least one bin above DC");
+    static_assert(BinsPerBar >= 1, "More bars than bins in the band");
+    static_assert(BinStart + Bars * BinsPerBar <= N/2, "The bars have to stay below the centre bin");
+
+    float MajorFreq;                            //Frequency with the maximum magnitude of the last spectrum
+    float MajorMagnitude;                       //Its magnitude
+
+    SpectrumPipeline() : MajorFreq(0), MajorMagnitude(0) {}
+
+    /*
+    *   Function to get the frequency of a bin.
+    *   Input: int Bin - The bin.
+    *   Output: float - Its frequency(Hz).
+    */
+    static constexpr float BinFrequency(int Bin){
+      return Bin * (float)Fs / N;
+    }
+
+    /*
+    *   Function to get the bar of the FFT plot a frequency falls in, it is rounded to the nearest bin first.
+    *   Input: float Frequency - The frequency(Hz).
+    *   Output: int - The bar, -1 if the frequency is not plotted.
+    */
+    static int BarOf(float Frequency){
+      int Bin = (int)floorf(Frequency * N / Fs + 0.5f);
+      int Bar = (Bin - BinStart) / BinsPerBar;
+      return (Bin < BinStart || Bar >= Bars)? -1 : Bar;
+    }
+
+    /*
+    *   Function to turn an FFT output into magnitudes and find the major frequency.
+    *   The magnitudes are written over the spectrum, Spectrum[i] holds the magnitude of bin i afterwards.
+    *   Bin i is written after the pair of bin i/2 has been read, so this works in place.
+    *   Only the bins of the band are computed, the others are set to 0. Spectrum[0] keeps the DC.
+    *   Input: float *Spectrum - FFT output in the rfft layout, N floats.
+    *   Output: float - The frequency with the maximum magnitude, 0 if the band is silent.
+    */
+    float Magnitudes(float *Spectrum){
+      float Max = 0;
+      int Major = 0;
+      for(int i = 1; i < BinStart; i++){
+        Spectrum[i] = 0;
+      }
+      for(int i = BinStart; i <= LastBin; i++){
+        float re = Spectrum[2*i], im = Spectrum[2*i + 1];
+        float m = sqrtf(re * re + im * im);
+        Spectrum[i] = m;
+        if(m > Max){
+          Max = m;
+          Major = i;
+        }
+      }
+      for(int i = LastBin + 1; i < N/2; i++){
+        Spectrum[i] = 0;
+      }
+      MajorMagnitude = Max;
+      MajorFreq = (Major > 0)? BinFrequency(Major) : 0;
+      return MajorFreq;
+    }
+
+    /*
+    *   Function to sum the magnitudes of the band into the bars of the FFT plot, BinsPerBar bins per bar.
+    *   Input: const float *Magnitude - Magnitude of every bin, indexed by bin (Spectrum after Magnitudes()).
+    *   Input: uint32_t *DisplayData - Set to the height of every bar, Bars of them.
+    *   Output: None.
+    */
+    void PrepareBars(const float *Magnitude, uint32_t *DisplayData) const{
+      const float *m = Magnitude + BinStart;
+      for(int b = 0; b < Bars; b++, m += BinsPerBar){
+        float Sum = 0;
+        for(int j = 0; j < BinsPerBar; j++){
+          Sum += m[j];
+        }
+        DisplayData[b] = Sum;
+      }
+    }
+};
+
+//Out of class definitions, so the constants can also be bound to references (min(), std::max()).
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::BinSize;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::BinStart;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::BinEnd;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::PlanEnd;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::LastBin;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::BinsPerBar;
+template <int N, int Fs, int Bars, int FreqStart, int FreqEnd> constexpr int SpectrumPipeline<N, Fs, Bars, FreqStart, FreqEnd>::Channels;
+#endif //_SPECTRUMPIPELINE_H
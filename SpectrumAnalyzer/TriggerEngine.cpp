@@ -0,0 +1,161 @@
+/*
+*   TriggerEngine.cpp
+*   Created on: Oct 19, 2026
+*   Edge trigger with hysteresis, holdoff and auto/normal/single modes for the waveform plot.
+*/
+#include "TriggerEngine.h"
+#include <string.h>
+
+//Functions
+
+/*
+*   Function to set up the trigger.
+*   Input: TriggerEngine *T - The trigger.
+*   Input: uint8_t Edge - TriggerEdge.
+*   Input: uint8_t Mode - TriggerMode.
+*   Input: float Level - Trigger level(ADC counts), relative to the average of the capture.
+*   Input: float Hysteresis - How far(ADC counts) the signal has to be on the other side of the level to arm the trigger.
+*   Input: unsigned long Holdoff - Least samples between two triggers.
+*   Input: int Window - Samples the plot draws from the trigger on.
+*   Input: float *Tails - Room for 2 * Window samples, the end of the last capture. NULL only searches where a capture leaves room for the window.
+*   Output: None.
+*/
+void InitializeTriggerEngine(TriggerEngine *T, uint8_t Edge, uint8_t Mode, float Level, float Hysteresis, unsigned long Holdoff, int Window, float *Tails){
+  T->Edge = Edge;
+  T->Mode = Mode;
+  T->Level = Level;
+  T->Hysteresis = (Hysteresis < 0)? -Hysteresis : Hysteresis;
+  T->Holdoff = Holdoff;
+  T->Window = Window;
+  T->Tail = Tails;
+  T->NextTail = (Tails != NULL)? Tails + Window : NULL;
+  T->Triggers = 0;
+  T->AutoRuns = 0;
+  ArmTrigger(T);
+}
+
+/*
+*   Function to start looking for a trigger afresh, this is what re-arms TRIGGER_SINGLE.
+*   Input: TriggerEngine *T - The trigger.
+*   Output: None.
+*/
+void ArmTrigger(TriggerEngine *T){
+  T->Armed = false;
+  T->Held = false;
+  T->HasTriggered = false;
+  T->LastTrigger = 0;
+  T->LastSequence = 0;
+  T->Untriggered = 0;
+  T->HasTail = false;
+}
+
+/*
+*   Function to find the trigger point of a capture, one pass over the samples that stops at the first edge.
+*   A falling edge is a rising edge of the negated signal, so both run the same loop.
+*   The trigger arms once the signal is below Level - Hysteresis and fires when it then reaches Level.
+*   Captures follow each other without a gap, so a capture number one up from the last one continues
+*   the signal: the arming and the holdoff carry over. After a dropped capture the trigger arms afresh.
+*   A capture only leaves Window samples after the edges in its first Count - Window samples, with a
+*   window close to the capture that is too short for one period of a low tone. So with Tails the end
+*   of every capture is kept and searched first with the next one, and the window of an edge found
+*   there is moved to the start of Samples: the end of the last capture, then this one.
+*   Costs one or two compares per sample up to the trigger, plus a short scan back and a copy of Window samples.
+*   Input: TriggerEngine *T - The trigger.
+*   Input: float *Samples - The capture, rearranged for an edge in the last capture.
+*   Input: int Count - Number of samples, at least Window.
+*   Input: float Average - Average of the capture, the level is relative to it.
+*   Input: unsigned long Sequence - Capture number.
+*   Output: int - First sample of the window to draw, -1 if the capture should not be drawn (the plot keeps the last one).
+*/
+int FindTrigger(TriggerEngine *T, float *Samples, int Count, float Average, unsigned long Sequence){
+  if(T->Mode == TRIGGER_SINGLE && T->Held){
+    return -1;
+  }
+  bool Continues = (Sequence == T->LastSequence + 1);
+  bool Armed = T->Armed && Continues;
+  float Sign = (T->Edge == TRIGGER_FALLING)? -1.0 : 1.0;
+  float Level = Sign * (Average + T->Level);
+  float ArmLevel = Level - T->Hysteresis;
+  unsigned long Base = Sequence * (unsigned long)Count;
+  int Last = Count - T->Window;
+  int Found = -1;
+  int Carried = 0;                              //Samples of the last capture in front of the window
+
+  //1. The end of the last capture that its own search left out, Tail[0] is its sample Last.
+  if(T->Tail != NULL && T->HasTail && Continues){
+    for(int j = 1; j < T->Window; j++){
+      float s = Sign * T->Tail[j];
+      if(s < ArmLevel){
+        Armed = true;
+      }
+      else if(Armed && s >= Level){
+        Armed = false;
+        if(!T->HasTriggered || (Base - T->Window + j - T->LastTrigger >= T->Holdoff)){
+          Carried = T->Window - j;
+          break;
+        }
+      }
+    }
+  }
+
+  //2. Forward to the first edge that is not in the holdoff.
+  for(int i = 0; Carried == 0 && i <= Last; i++){
+    float s = Sign * Samples[i];
+    if(s < ArmLevel){
+      Armed = true;
+    }
+    else if(Armed && s >= Level){
+      Armed = false;
+      if(!T->HasTriggered || (Base + i - T->LastTrigger >= T->Holdoff)){
+        Found = i;
+        break;
+      }
+    }
+  }
+
+  //3. State for the next capture: set by the last sample that was below the arm level or above the level.
+  //With Tails the next capture searches on from sample Last, otherwise from the end of this one.
+  int End = (T->Tail != NULL)? Last : Count - 1;
+  int Scanned = (Found >= 0)? Found : ((Carried > 0)? -1 : Last);
+  for(int i = End; i > Scanned; i--){
+    float s = Sign * Samples[i];
+    if(s < ArmLevel || s >= Level){
+      Armed = (s < ArmLevel);
+      break;
+    }
+  }
+  T->Armed = Armed;
+  T->LastSequence = Sequence;
+
+  //4. Keep the end of this capture, then move the window of an edge in the last one to the start.
+  if(T->Tail != NULL){
+    float *Tail = T->Tail;
+    memcpy(T->NextTail, Samples + Last, T->Window * sizeof(float));
+    T->Tail = T->NextTail;
+    T->NextTail = Tail;
+    T->HasTail = true;
+    if(Carried > 0){
+      memmove(Samples + Carried, Samples, (T->Window - Carried) * sizeof(float));
+      memcpy(Samples, Tail + T->Window - Carried, Carried * sizeof(float));
+      Found = 0;
+    }
+  }
+
+  //5. What to draw, by mode.
+  if(Found >= 0){
+    T->Triggers++;
+    T->LastTrigger = Base + Found - Carried;
+    T->HasTriggered = true;
+    T->Untriggered = 0;
+    T->Held = (T->Mode == TRIGGER_SINGLE);
+    return Found;
+  }
+  if(T->Untriggered < 255){
+    T->Untriggered++;
+  }
+  if(T->Mode == TRIGGER_AUTO && T->Untriggered >= TRIGGER_AUTO_FRAMES){
+    T->AutoRuns++;
+    return 0;
+  }
+  return -1;
+}
@@ -0,0 +1,62 @@
+/*
+    * TriggerEngine.h
+    *
+    *  Created on: Oct 19, 2026
+    *  This header file holds the edge trigger of the waveform plot. Like on an
+    *  oscilloscope it finds where the signal crosses the trigger level on the
+    *  chosen edge, with hysteresis against noise and a holdoff between
+    *  triggers, so the plot can start there and a periodic signal stands still.
+    *  The end of every capture is kept, so an edge too close to the end to
+    *  leave room for the plot is still found with the next capture.
+    *  Does not depend on the ESP32.
+    *
+*/
+#ifndef _TRIGGERENGINE_H
+#define _TRIGGERENGINE_H
+
+#include <stdint.h>
+
+//Defines
+#define TRIGGER_EDGE TRIGGER_RISING             //TRIGGER_RISING or TRIGGER_FALLING
+#define TRIGGER_MODE TRIGGER_AUTO               //TRIGGER_AUTO, TRIGGER_NORMAL or TRIGGER_SINGLE
+#define TRIGGER_LEVEL 0.0                       //Trigger level(ADC counts), relative to the average of the capture
+#define TRIGGER_HYSTERESIS 20.0                 //The signal has to be this far(ADC counts) on the other side of the level before an edge counts
+#define TRIGGER_HOLDOFF_US 0                    //Least time between two triggers, 0 for none
+#define TRIGGER_AUTO_FRAMES 3                   //Captures without a trigger before TRIGGER_AUTO draws anyway
+
+enum TriggerEdge{
+  TRIGGER_RISING,
+  TRIGGER_FALLING
+};
+
+enum TriggerMode{
+  TRIGGER_AUTO,                                 //Draws from the trigger, or from the start of the capture if there has been none for a while
+  TRIGGER_NORMAL,                               //Only draws captures with a trigger, the last one stays on the screen
+  TRIGGER_SINGLE                                //Draws the first capture with a trigger and then holds it until re-armed
+};
+
+struct TriggerEngine{
+  uint8_t Edge;                                 //TriggerEdge
+  uint8_t Mode;                                 //TriggerMode
+  float Level;
+  float Hysteresis;
+  unsigned long Holdoff;                        //Least samples between two triggers
+  int Window;                                   //Samples drawn from the trigger on, the trigger has to leave room for them
+  float *Tail;                                  //Last Window samples of the previous capture, NULL if edges across two captures are not searched
+  float *NextTail;                              //Where the end of this capture is kept, swapped with Tail
+  bool HasTail;                                 //Tail holds the capture numbered LastSequence
+  bool Armed;                                   //The signal has been beyond the hysteresis, the next crossing is an edge
+  bool Held;                                    //TRIGGER_SINGLE has its capture
+  unsigned long LastTrigger;                    //Sample number of the last trigger, counted over all captures
+  bool HasTriggered;
+  unsigned long LastSequence;                   //Capture number of the last capture scanned
+  uint8_t Untriggered;                          //Captures in a row without a trigger
+  unsigned long Triggers;
+  unsigned long AutoRuns;                       //Captures TRIGGER_AUTO drew without a trigger
+};
+
+//Function Prototypes
+void InitializeTriggerEngine(TriggerEngine *T, uint8_t Edge, uint8_t Mode, float Level, float Hysteresis, unsigned long Holdoff, int Window, float *Tails);
+void ArmTrigger(TriggerEngine *T);
+int  FindTrigger(TriggerEngine *T, float *Samples, int Count, float Average, unsigned long Sequence);
+#endif //_TRIGGERENGINE_H